@@ -7,6 +7,7 @@
 
 #include <nil/crypto3/multiprecision/cpp_int.hpp>
 #include <nil/crypto3/multiprecision/miller_rabin.hpp>
+#include <nil/crypto3/multiprecision/prime_generator.hpp>
 #include <iostream>
 #include <iomanip>
 
@@ -24,22 +25,26 @@ int main()
    //
    mt19937 gen2(clock());
 
-   for(unsigned i = 0; i < 100000; ++i)
+   //
+   // Walk the candidates up from a random start: p and (p-1)/2 are sieved together by their residues
+   // modulo the first few thousand primes, and only the survivors reach the Baillie-PSW test:
+   //
+   int_type start = gen();
+   bit_set(start, 255);
+   prime_generator<int_type> generator(start, true);
+
+   int_type n = generator.next();
+   std::cout << "We have a probable safe prime with value: " << std::hex << std::showbase << n << std::endl;
+   //
+   // Confirm the result with the probabilistic Miller-Rabin test as well:
+   //
+   if(miller_rabin_test(n, 25, gen2) && miller_rabin_test((n-1)/2, 25, gen2))
    {
-      int_type n = gen();
-      if(miller_rabin_test(n, 25, gen2))
-      {
-         // Value n is probably prime, see if (n-1)/2 is also prime:
-         std::cout << "We have a probable prime with value: " << std::hex << std::showbase << n << std::endl;
-         if(miller_rabin_test((n-1)/2, 25, gen2))
-         {
-            std::cout << "We have a safe prime with value: " << std::hex << std::showbase << n << std::endl;
-            return 0;
-         }
-      }
+      std::cout << "We have a safe prime with value: " << std::hex << std::showbase << n << std::endl;
+      return 0;
    }
-   std::cout << "Ooops, no safe primes were found - probably a bad choice of seed values!" << std::endl;
-   return 0;
+   std::cout << "Ooops, the Miller-Rabin test disagrees!" << std::endl;
+   return 1;
 }
 
 //]
@@ -0,0 +1,142 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef BOOST_MULTIPRECISION_BAILLIE_PSW_HPP
+#define BOOST_MULTIPRECISION_BAILLIE_PSW_HPP
+
+#include <nil/crypto3/multiprecision/miller_rabin.hpp>
+#include <nil/crypto3/multiprecision/jacobi.hpp>
+
+#include <cstdint>
+
+namespace nil {
+    namespace crypto3 {
+        namespace multiprecision {
+            //
+            // Baillie-PSW test of a fixed odd n > 3: a strong probable prime test to base 2 followed by a strong
+            // Lucas probable prime test with the parameters of Selfridge's method A. Both halves work on the
+            // residues of the same arithmetic, for cpp_int it is a single Montgomery context built for n.
+            //
+            template<class I>
+            class baillie_psw_engine : public miller_rabin_engine<I> {
+                typedef miller_rabin_engine<I> base_type;
+                typedef typename base_type::arithmetic_type arithmetic_type;
+                typedef typename base_type::element_type element_type;
+
+            public:
+                explicit baillie_psw_engine(const I& n) : base_type(n) {
+                }
+
+                //
+                // Strong Lucas test with P = 1, Q = (1 - D) / 4 and D the first of 5, -7, 9, -11, ... with
+                // jacobi(D, n) = -1. Writing n + 1 = d * 2^s with odd d, n passes if U_d = 0 or V_(d * 2^r) = 0
+                // for some r < s.
+                //
+                bool is_strong_lucas_probable_prime() {
+                    arithmetic_type& arithmetic = this->m_arithmetic;
+                    const I& n = this->m_n;
+
+                    std::uint32_t abs_d = 5u;
+                    bool is_d_negative = false;
+                    while (true) {
+                        int j = jacobi(is_d_negative ? I(n - abs_d) : I(abs_d), n);
+                        if (j == -1) {
+                            break;
+                        }
+                        if (j == 0) {
+                            return false;    // 1 < gcd(D, n) and |D| < n
+                        }
+                        if (abs_d == 17u) {
+                            /// there is no such D for a perfect square
+                            I remainder;
+                            sqrt(n, remainder);
+                            if (remainder == 0u) {
+                                return false;
+                            }
+                        }
+                        abs_d += 2u;
+                        is_d_negative = !is_d_negative;
+                    }
+
+                    const std::uint32_t abs_q = is_d_negative ? (abs_d + 1u) / 4u : (abs_d - 1u) / 4u;
+                    element_type d = arithmetic.to_element(is_d_negative ? I(n - abs_d) : I(abs_d));
+                    element_type q = arithmetic.to_element(is_d_negative ? I(abs_q) : I(n - abs_q));
+
+                    /// (n + 1) / 2 does not overflow for n of the maximal value of a fixed width type
+                    I k = (n >> 1u) + 1u;
+                    unsigned shift = lsb(k);
+                    const unsigned s = 1u + shift;
+                    k >>= shift;
+
+                    /// U_1 = 1, V_1 = P = 1, left-to-right over the bits of d
+                    element_type u = this->m_one, v = this->m_one, qk = q, t;
+                    for (unsigned i = msb(k); i-- > 0;) {
+                        /// U_2k = U_k * V_k, V_2k = V_k^2 - 2 * Q^k
+                        arithmetic.mul(u, u, v);
+                        arithmetic.square(v);
+                        arithmetic.add(t, qk, qk);
+                        arithmetic.sub(v, v, t);
+                        arithmetic.square(qk);
+
+                        if (bit_test(k, i)) {
+                            /// U_(k + 1) = (U_k + V_k) / 2, V_(k + 1) = (D * U_k + V_k) / 2
+                            arithmetic.mul(t, d, u);
+                            arithmetic.add(u, u, v);
+                            arithmetic.half(u, u);
+                            arithmetic.add(v, t, v);
+                            arithmetic.half(v, v);
+                            arithmetic.mul(qk, qk, q);
+                        }
+                    }
+
+                    if (u == this->m_zero || v == this->m_zero) {
+                        return true;
+                    }
+                    for (unsigned r = 1; r < s; ++r) {
+                        arithmetic.square(v);
+                        arithmetic.add(t, qk, qk);
+                        arithmetic.sub(v, v, t);
+                        if (v == this->m_zero) {
+                            return true;
+                        }
+                        arithmetic.square(qk);
+                    }
+                    return false;
+                }
+
+                bool is_probable_prime() {
+                    return this->is_strong_probable_prime(I(2u)) && is_strong_lucas_probable_prime();
+                }
+            };
+
+            //
+            // Baillie-PSW probable prime test: no composite passing it is known, it costs about three
+            // Miller-Rabin rounds
+            //
+            template<class I>
+            typename std::enable_if<is_number<I>::value && number_category<I>::value == number_kind_integer,
+                                    bool>::type
+                baillie_psw_test(const I& n) {
+                bool is_prime;
+                if (detail::is_decided_by_small_primes(n, is_prime))
+                    return is_prime;
+
+                baillie_psw_engine<I> engine(n);
+                return engine.is_probable_prime();
+            }
+
+            template<class tag, class Arg1, class Arg2, class Arg3, class Arg4>
+            bool baillie_psw_test(const detail::expression<tag, Arg1, Arg2, Arg3, Arg4>& n) {
+                using number_type = typename detail::expression<tag, Arg1, Arg2, Arg3, Arg4>::result_type;
+                return baillie_psw_test(number_type(n));
+            }
+        }    // namespace multiprecision
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // BOOST_MULTIPRECISION_BAILLIE_PSW_HPP
@@ -26,6 +26,7 @@
 #include <nil/crypto3/multiprecision/detail/big_lanczos.hpp>
 #include <nil/crypto3/multiprecision/detail/dynamic_array.hpp>
 #include <nil/crypto3/multiprecision/detail/itos.hpp>
+#include <nil/crypto3/multiprecision/cpp_int/ntt.hpp>
 
 //
 // Headers required for Boost.Math integration:
@@ -2210,6 +2211,28 @@ namespace nil {
 
                     std::uint64_t carry = static_cast<std::uint64_t>(0u);
 
+#ifdef BOOST_MP_HAS_NTT_MULTIPLY
+                    //
+                    // At the highest precisions the sums are taken from a number theoretic transform instead, by the
+                    // same bound they fit in the low limb of the convolution coefficients:
+                    //
+                    if (p >= static_cast<std::int32_t>(1000)) {
+                        std::vector<std::uint64_t> sums(p);
+                        backends::ntt_convolution(u, p, v, p, [&](std::size_t k, const limb_type* c) {
+                            if (k < sums.size()) {
+                                sums[k] = c[0];
+                            }
+                        });
+                        for (std::int32_t j = p - 1; j >= static_cast<std::int32_t>(0); j--) {
+                            const std::uint64_t sum = carry + sums[j];
+
+                            u[j] = static_cast<std::uint32_t>(sum % cpp_dec_float_elem_mask);
+                            carry = static_cast<std::uint64_t>(sum / cpp_dec_float_elem_mask);
+                        }
+                        return static_cast<std::uint32_t>(carry);
+                    }
+#endif
+
                     for (std::int32_t j = static_cast<std::int32_t>(p - 1u); j >= static_cast<std::int32_t>(0); j--) {
                         std::uint64_t sum = carry;
 
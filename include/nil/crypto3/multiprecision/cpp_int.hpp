@@ -2649,11 +2649,14 @@ namespace nil {
 #include <nil/crypto3/multiprecision/cpp_int/multiply.hpp>
 #include <nil/crypto3/multiprecision/cpp_int/divide.hpp>
 #include <nil/crypto3/multiprecision/cpp_int/bitwise.hpp>
+#include <nil/crypto3/multiprecision/cpp_int/half_gcd.hpp>
 #include <nil/crypto3/multiprecision/cpp_int/misc.hpp>
+#include <nil/crypto3/multiprecision/cpp_int/divider.hpp>
 #include <nil/crypto3/multiprecision/cpp_int/literals.hpp>
 #include <nil/crypto3/multiprecision/cpp_int/serialize.hpp>
 #include <nil/crypto3/multiprecision/cpp_int/import_export.hpp>
 #include <nil/crypto3/multiprecision/cpp_int/eval_jacobi.hpp>
+#include <nil/crypto3/multiprecision/cpp_int/powm.hpp>
 //#include <nil/crypto3/multiprecision/cpp_int/eval_ressol.hpp>
 
 #endif
@@ -8,10 +8,153 @@
 #ifndef BOOST_MP_CPP_INT_DIV_HPP
 #define BOOST_MP_CPP_INT_DIV_HPP
 
+#include <nil/crypto3/multiprecision/detail/bitscan.hpp>
+
+#include <algorithm>
+
 namespace nil {
     namespace crypto3 {
         namespace multiprecision {
             namespace backends {
+//
+// Minimum number of limbs in both the divisor and the quotient for the recursive division of Burnikel and
+// Ziegler to replace the long division below:
+//
+#ifdef BOOST_MP_BURNIKEL_ZIEGLER_CUTOFF
+                const size_t burnikel_ziegler_cutoff = BOOST_MP_BURNIKEL_ZIEGLER_CUTOFF;
+#else
+                const size_t burnikel_ziegler_cutoff = 60;
+#endif
+//
+// Minimum number of limbs in the divisor for the division by a Newton reciprocal to replace Burnikel-Ziegler.
+// The reciprocal costs about as much as one division of 2n by n limbs, so it is only computed for quotients of
+// at least 3n limbs, or once for all divisions by the same divisor:
+//
+#ifdef BOOST_MP_NEWTON_DIVISION_CUTOFF
+                const size_t newton_division_cutoff = BOOST_MP_NEWTON_DIVISION_CUTOFF;
+#else
+                const size_t newton_division_cutoff = 2000;
+#endif
+
+                template<class CppInt1, class CppInt2, class CppInt3>
+                inline void divide_unsigned_subquadratic(CppInt1* result, const CppInt2& x, const CppInt3& y,
+                                                         CppInt1& r);
+
+                //
+                // Division by invariant integers of Moller and Granlund, "Improved division by invariant integers",
+                // IEEE Transactions on Computers 60 (2011), 165-175. For a normalized limb d, with its most
+                // significant bit set, the reciprocal v = floor((2^(2 limb_bits) - 1) / d) - 2^limb_bits replaces
+                // the division of two limbs by d with two multiplications:
+                //
+                inline BOOST_MP_CXX14_CONSTEXPR limb_type divide_reciprocal_2by1(limb_type d) {
+                    return static_cast<limb_type>(~(static_cast<double_limb_type>(d) << bits_per_limb) / d);
+                }
+
+                //
+                // q = floor((u1, u0) / d) and r = (u1, u0) - q d for u1 < d
+                //
+                BOOST_MP_FORCEINLINE BOOST_MP_CXX14_CONSTEXPR limb_type divide_2by1(limb_type& r, limb_type u1,
+                                                                                   limb_type u0, limb_type d,
+                                                                                   limb_type v) {
+                    const double_limb_type p = static_cast<double_limb_type>(v) * u1 +
+                                               ((static_cast<double_limb_type>(u1) << bits_per_limb) | u0);
+                    limb_type q1 = static_cast<limb_type>(p >> bits_per_limb) + 1;
+                    const limb_type q0 = static_cast<limb_type>(p);
+                    r = u0 - q1 * d;
+                    if (r > q0) {
+                        --q1;
+                        r += d;
+                    }
+                    if (r >= d) {
+                        ++q1;
+                        r -= d;
+                    }
+                    return q1;
+                }
+
+                //
+                // The reciprocal v = floor((2^(3 limb_bits) - 1) / (d1, d0)) - 2^limb_bits of a normalized two limb
+                // divisor, for the division of three limbs by two limbs below
+                //
+                inline BOOST_MP_CXX14_CONSTEXPR limb_type divide_reciprocal_3by2(limb_type d1, limb_type d0) {
+                    limb_type v = divide_reciprocal_2by1(d1);
+                    limb_type p = d1 * v + d0;
+                    if (p < d0) {
+                        --v;
+                        if (p >= d1) {
+                            --v;
+                            p -= d1;
+                        }
+                        p -= d1;
+                    }
+                    const double_limb_type t = static_cast<double_limb_type>(v) * d0;
+                    const limb_type t1 = static_cast<limb_type>(t >> bits_per_limb), t0 = static_cast<limb_type>(t);
+                    p += t1;
+                    if (p < t1) {
+                        --v;
+                        if ((p > d1) || ((p == d1) && (t0 >= d0)))
+                            --v;
+                    }
+                    return v;
+                }
+
+                //
+                // q = floor((u2, u1, u0) / (d1, d0)) and (r1, r0) = (u2, u1, u0) - q (d1, d0) for (u2, u1) < (d1, d0)
+                //
+                BOOST_MP_FORCEINLINE BOOST_MP_CXX14_CONSTEXPR limb_type divide_3by2(limb_type& r1, limb_type& r0,
+                                                                                   limb_type u2, limb_type u1,
+                                                                                   limb_type u0, limb_type d1,
+                                                                                   limb_type d0, limb_type v) {
+                    const double_limb_type p = static_cast<double_limb_type>(v) * u2 +
+                                               ((static_cast<double_limb_type>(u2) << bits_per_limb) | u1);
+                    limb_type q1 = static_cast<limb_type>(p >> bits_per_limb);
+                    const limb_type q0 = static_cast<limb_type>(p);
+                    const double_limb_type d = (static_cast<double_limb_type>(d1) << bits_per_limb) | d0;
+                    double_limb_type r = (static_cast<double_limb_type>(static_cast<limb_type>(u1 - q1 * d1))
+                                          << bits_per_limb) |
+                                         u0;
+                    r -= static_cast<double_limb_type>(d0) * q1 + d;
+                    ++q1;
+                    if (static_cast<limb_type>(r >> bits_per_limb) >= q0) {
+                        --q1;
+                        r += d;
+                    }
+                    if (r >= d) {
+                        ++q1;
+                        r -= d;
+                    }
+                    r1 = static_cast<limb_type>(r >> bits_per_limb);
+                    r0 = static_cast<limb_type>(r);
+                    return q1;
+                }
+
+                //
+                // Division of the n limbs p by a normalized limb d with reciprocal v, the dividend is taken shifted
+                // left by shift bits.  The quotient limbs go to q as far as they fit into its q_size limbs, the
+                // remainder, shifted back, is returned:
+                //
+                inline BOOST_MP_CXX14_CONSTEXPR limb_type divide_limbs_by_normalized_limb(limb_type* q, unsigned q_size,
+                                                                                        const limb_type* p, unsigned n,
+                                                                                        limb_type d, limb_type v,
+                                                                                        unsigned shift) {
+                    limb_type r = shift ? p[n - 1] >> (bits_per_limb - shift) : 0u;
+                    for (unsigned i = n; i-- > 0;) {
+                        const limb_type u = shift ? (p[i] << shift) | (i ? p[i - 1] >> (bits_per_limb - shift) : 0u) :
+                                                    p[i];
+                        const limb_type qi = divide_2by1(r, r, u, d, v);
+                        if (i < q_size)
+                            q[i] = qi;
+                    }
+                    return r >> shift;
+                }
+
+                inline BOOST_MP_CXX14_CONSTEXPR limb_type divide_limbs_by_limb(limb_type* q, unsigned q_size,
+                                                                             const limb_type* p, unsigned n,
+                                                                             limb_type d) {
+                    const unsigned shift = bits_per_limb - 1 - nil::crypto3::multiprecision::detail::find_msb(d);
+                    d <<= shift;
+                    return divide_limbs_by_normalized_limb(q, q_size, p, n, d, divide_reciprocal_2by1(d), shift);
+                }
 
                 template<class CppInt1, class CppInt2, class CppInt3>
                 BOOST_MP_CXX14_CONSTEXPR void
@@ -68,6 +211,20 @@ namespace nil {
                         divide_unsigned_helper(result, x, y.limbs()[y_order], r);
                         return;
                     }
+                    //
+                    // Large quotients by large divisors go to the subquadratic routines, which come back here for
+                    // their base cases:
+                    //
+#ifndef BOOST_MP_NO_CONSTEXPR_DETECTION
+                    if (!BOOST_MP_IS_CONST_EVALUATED(y_order) && (y.size() >= burnikel_ziegler_cutoff) &&
+                        (x.size() >= y.size() + burnikel_ziegler_cutoff))
+#else
+                    if ((y.size() >= burnikel_ziegler_cutoff) && (x.size() >= y.size() + burnikel_ziegler_cutoff))
+#endif
+                    {
+                        divide_unsigned_subquadratic(result, x, y, r);
+                        return;
+                    }
 
                     typename CppInt2::const_limb_pointer px = x.limbs();
                     typename CppInt3::const_limb_pointer py = y.limbs();
@@ -343,58 +500,375 @@ namespace nil {
                         return;
                     }
 
-                    // This is initialised just to keep the compiler from emitting useless warnings later on:
-                    typename CppInt1::limb_pointer pres = typename CppInt1::limb_pointer();
+                    //
+                    // Long division by the Moller-Granlund reciprocal of y, one limb of the quotient per step:
+                    //
+                    limb_type rem = 0;
                     if (result) {
                         result->resize(r_order + 1, r_order + 1);
-                        pres = result->limbs();
-                        if (result->size() > r_order)
-                            pres[r_order] = 0;    // just in case we don't set the most significant limb below.
+                        rem = divide_limbs_by_limb(result->limbs(), result->size(), x.limbs(), r_order + 1, y);
+                        result->normalize();
+                        result->sign(x.sign());
+                    } else {
+                        rem = divide_limbs_by_limb(static_cast<limb_type*>(nullptr), 0, x.limbs(), r_order + 1, y);
                     }
+                    r = rem;
+                    r.sign(x.sign());
 
-                    do {
-                        //
-                        // Calculate our best guess for how many times y divides into r:
-                        //
-                        if ((pr[r_order] < y) && r_order) {
-                            double_limb_type a =
-                                (static_cast<double_limb_type>(pr[r_order]) << CppInt1::limb_bits) | pr[r_order - 1];
-                            double_limb_type b = a % y;
-                            r.resize(r.size() - 1, r.size() - 1);
-                            --r_order;
-                            pr[r_order] = static_cast<limb_type>(b);
-                            if (result)
-                                pres[r_order] = static_cast<limb_type>(a / y);
-                            if (r_order && pr[r_order] == 0) {
-                                --r_order;    // No remainder, division was exact.
-                                r.resize(r.size() - 1, r.size() - 1);
-                                if (result)
-                                    pres[r_order] = static_cast<limb_type>(0u);
-                            }
+                    BOOST_ASSERT(r.compare(y) < 0);    // remainder must be less than the divisor or our code has failed
+                }
+
+                //
+                // The subquadratic division works on variable precision values, in units of whole limbs:
+                // result = (a >> offset limbs) mod 2^(len limbs).
+                //
+                template<class CppInt>
+                inline void divide_limb_slice(CppInt& result, const CppInt& a, unsigned offset, unsigned len) {
+                    BOOST_ASSERT(&result != &a);
+                    if (offset >= a.size()) {
+                        result = static_cast<limb_type>(0u);
+                        return;
+                    }
+                    len = (std::min)(len, a.size() - offset);
+                    if (len == 0) {
+                        result = static_cast<limb_type>(0u);
+                        return;
+                    }
+                    result.resize(len, len);
+                    std::memcpy(result.limbs(), a.limbs() + offset, len * sizeof(limb_type));
+                    result.sign(false);
+                    result.normalize();
+                }
+
+                //
+                // result = a * 2^(shift limbs) + b
+                //
+                template<class CppInt>
+                inline void divide_limb_join(CppInt& result, unsigned shift, const CppInt& b) {
+                    eval_left_shift(result, shift * CppInt::limb_bits);
+                    eval_add(result, b);
+                }
+
+                //
+                // The reciprocal of the leading two limbs of b with its most significant bit set, for
+                // divide_schoolbook
+                //
+                template<class CppInt>
+                inline limb_type divide_reciprocal_of(const CppInt& b) {
+                    return b.size() < 2 ? limb_type(0) :
+                                          divide_reciprocal_3by2(b.limbs()[b.size() - 1], b.limbs()[b.size() - 2]);
+                }
+
+                //
+                // p -= q b for n limbs, returns the limb borrowed from above p
+                //
+                inline limb_type divide_submul(limb_type* p, const limb_type* b, unsigned n, limb_type q) {
+                    limb_type carry = 0;
+                    for (unsigned i = 0; i < n; ++i) {
+                        const double_limb_type t = static_cast<double_limb_type>(b[i]) * q + carry;
+                        const limb_type low = static_cast<limb_type>(t);
+                        carry = static_cast<limb_type>(t >> bits_per_limb);
+                        carry += p[i] < low;
+                        p[i] -= low;
+                    }
+                    return carry;
+                }
+
+                //
+                // p += b for n limbs, returns the carry
+                //
+                inline limb_type divide_add(limb_type* p, const limb_type* b, unsigned n) {
+                    double_limb_type carry = 0;
+                    for (unsigned i = 0; i < n; ++i) {
+                        carry += static_cast<double_limb_type>(p[i]) + b[i];
+                        p[i] = static_cast<limb_type>(carry);
+                        carry >>= bits_per_limb;
+                    }
+                    return static_cast<limb_type>(carry);
+                }
+
+                //
+                // Schoolbook division of Knuth, TAOCP vol. 2, 4.3.1, Algorithm D, for b of n >= 2 limbs with its most
+                // significant bit set and v the reciprocal of its leading two limbs: each limb of the quotient is the
+                // quotient of the leading three limbs of the remainder by the leading two limbs of b, which is at
+                // most one too large.
+                //
+                template<class CppInt>
+                void divide_schoolbook(CppInt* q, CppInt& r, const CppInt& a, const CppInt& b, limb_type v) {
+                    const unsigned n = b.size();
+                    if (n < 2) {
+                        divide_unsigned_helper(q, a, b, r);
+                        return;
+                    }
+                    BOOST_ASSERT(&r != &a);
+                    if (a.size() < n) {
+                        r = a;
+                        if (q)
+                            *q = static_cast<limb_type>(0u);
+                        return;
+                    }
+                    const unsigned m = a.size() - n;
+                    r.resize(a.size() + 1, a.size() + 1);
+                    typename CppInt::limb_pointer pr = r.limbs();
+                    std::copy(a.limbs(), a.limbs() + a.size(), pr);
+                    pr[a.size()] = 0;
+                    r.sign(false);
+                    typename CppInt::limb_pointer pq = typename CppInt::limb_pointer();
+                    if (q) {
+                        q->resize(m + 1, m + 1);
+                        q->sign(false);
+                        pq = q->limbs();
+                    }
+                    typename CppInt::const_limb_pointer pb = b.limbs();
+                    const limb_type d1 = pb[n - 1], d0 = pb[n - 2];
+                    for (unsigned j = m + 1; j-- > 0;) {
+                        limb_type* pj = pr + j;
+                        limb_type qj = ~static_cast<limb_type>(0u);
+                        if ((pj[n] == d1) && (pj[n - 1] == d0)) {
+                            //
+                            // The quotient limb is 2^limb_bits - 1, which can only leave a nonnegative remainder:
+                            //
+                            limb_type borrow = divide_submul(pj, pb, n, qj);
+                            pj[n] -= borrow;
                         } else {
-                            if (result)
-                                pres[r_order] = pr[r_order] / y;
-                            pr[r_order] %= y;
-                            if (r_order && pr[r_order] == 0) {
-                                --r_order;    // No remainder, division was exact.
-                                r.resize(r.size() - 1, r.size() - 1);
-                                if (result)
-                                    pres[r_order] = static_cast<limb_type>(0u);
+                            limb_type r1 = 0, r0 = 0;
+                            qj = divide_3by2(r1, r0, pj[n], pj[n - 1], pj[n - 2], d1, d0, v);
+                            limb_type borrow = divide_submul(pj, pb, n - 2, qj);
+                            const limb_type borrow0 = r0 < borrow;
+                            r0 -= borrow;
+                            const limb_type borrow1 = r1 < borrow0;
+                            r1 -= borrow0;
+                            pj[n - 2] = r0;
+                            pj[n - 1] = r1;
+                            pj[n] = 0;
+                            if (borrow1) {
+                                --qj;
+                                pj[n] += divide_add(pj, pb, n);
                             }
                         }
+                        if (q)
+                            pq[j] = qj;
                     }
-                    // Termination condition is really just a check that r >= y, but with two common
-                    // short-circuit cases handled first:
-                    while (r_order || (pr[r_order] >= y));
+                    r.resize(n, n);
+                    r.normalize();
+                    if (q)
+                        q->normalize();
+                }
 
-                    if (result) {
-                        result->normalize();
-                        result->sign(x.sign());
+                //
+                // The recursive division of Burnikel and Ziegler, "Fast Recursive Division", MPI-I-98-1-022, in
+                // the form of algorithm RecursiveDivRem of Brent and Zimmermann, "Modern Computer Arithmetic".
+                // b has n limbs and its most significant bit set, a has at most 2n limbs.  The quotient of the
+                // leading part of a by the leading n - k limbs of b is at most 2 too large, so the two halves of
+                // the quotient are found by two divisions of half the size and two multiplications.
+                //
+                template<class CppInt>
+                void divide_recursive(CppInt& q, CppInt& r, const CppInt& a, const CppInt& b, limb_type v) {
+                    using default_ops::eval_decrement;
+                    using default_ops::eval_subtract;
+
+                    const unsigned n = b.size();
+                    if ((n < burnikel_ziegler_cutoff) || (a.size() < n + burnikel_ziegler_cutoff)) {
+                        divide_schoolbook(&q, r, a, b, v);
+                        return;
                     }
-                    r.normalize();
-                    r.sign(x.sign());
+                    const unsigned k = (a.size() - n) / 2;
+                    CppInt b0, b1, t, u, q1;
+                    divide_limb_slice(b1, b, k, n - k);
+                    divide_limb_slice(b0, b, 0, k);
+                    //
+                    // High half: u = a - q1 b 2^(k limbs) with q1 = floor((a >> 2k limbs) / b1):
+                    //
+                    divide_limb_slice(t, a, 2 * k, a.size() - 2 * k);
+                    divide_recursive(q1, u, t, b1, v);
+                    divide_limb_slice(t, a, 0, 2 * k);
+                    divide_limb_join(u, 2 * k, t);
+                    eval_multiply(t, q1, b0);
+                    eval_left_shift(t, k * CppInt::limb_bits);
+                    eval_subtract(u, t);
+                    if (u.sign()) {
+                        t = b;
+                        eval_left_shift(t, k * CppInt::limb_bits);
+                        do {
+                            eval_decrement(q1);
+                            eval_add(u, t);
+                        } while (u.sign());
+                    }
+                    //
+                    // Low half, 0 <= u < b 2^(k limbs): r = u - q0 b with q0 = floor((u >> k limbs) / b1):
+                    //
+                    divide_limb_slice(t, u, k, u.size() - k);
+                    divide_recursive(q, r, t, b1, v);
+                    divide_limb_slice(t, u, 0, k);
+                    divide_limb_join(r, k, t);
+                    eval_multiply(t, q, b0);
+                    eval_subtract(r, t);
+                    while (r.sign()) {
+                        eval_decrement(q);
+                        eval_add(r, b);
+                    }
+                    divide_limb_join(q1, k, q);
+                    q.swap(q1);
+                }
 
-                    BOOST_ASSERT(r.compare(y) < 0);    // remainder must be less than the divisor or our code has failed
+                //
+                // x = floor(2^(2n limbs) / b) for b of n limbs with its most significant bit set.  Newton's
+                // iteration x' = x + x (2^(2n limbs) - b x) / 2^(2n limbs) doubles the number of correct limbs,
+                // it starts from the reciprocal of the leading h limbs of b, which has an error of a few units in
+                // its last place, and the result is corrected to the exact floor with a last multiplication.
+                //
+                template<class CppInt>
+                void divide_normalized(CppInt* q, CppInt& r, const CppInt& a, const CppInt& b, limb_type v,
+                                       const CppInt* reciprocal);
+
+                template<class CppInt>
+                void divide_newton_reciprocal(CppInt& x, const CppInt& b) {
+                    using default_ops::eval_decrement;
+                    using default_ops::eval_increment;
+                    using default_ops::eval_subtract;
+
+                    const unsigned n = b.size();
+                    CppInt e, t;
+                    e = static_cast<limb_type>(1u);
+                    eval_left_shift(e, 2 * n * CppInt::limb_bits);
+                    if (n < newton_division_cutoff) {
+                        divide_normalized(&x, t, e, b, divide_reciprocal_of(b), static_cast<const CppInt*>(nullptr));
+                        return;
+                    }
+                    const unsigned h = n / 2 + 1;
+                    CppInt bh, xh;
+                    divide_limb_slice(bh, b, n - h, h);
+                    divide_newton_reciprocal(xh, bh);
+                    //
+                    // With x = xh 2^(n - h limbs) the error 2^(2n limbs) - b x is e 2^(n - h limbs) for
+                    // e = 2^(n + h limbs) - b xh, which has about n limbs:
+                    //
+                    eval_right_shift(e, (n - h) * CppInt::limb_bits);
+                    eval_multiply(t, b, xh);
+                    eval_subtract(e, t);
+                    eval_multiply(t, xh, e);
+                    eval_right_shift(t, 2 * h * CppInt::limb_bits);
+                    x.swap(xh);
+                    eval_left_shift(x, (n - h) * CppInt::limb_bits);
+                    eval_add(x, t);
+                    //
+                    // Exact correction, e = 2^(2n limbs) - b x:
+                    //
+                    eval_multiply(t, b, x);
+                    e = static_cast<limb_type>(1u);
+                    eval_left_shift(e, 2 * n * CppInt::limb_bits);
+                    eval_subtract(e, t);
+                    while (e.sign()) {
+                        eval_decrement(x);
+                        eval_add(e, b);
+                    }
+                    while (e.compare(b) >= 0) {
+                        eval_increment(x);
+                        eval_subtract(e, b);
+                    }
+                }
+
+                //
+                // Division of a of at most 2n limbs by b of n limbs with its most significant bit set, given the
+                // reciprocal x = floor(2^(2n limbs) / b): the estimate (a >> n - 1 limbs) x >> n + 1 limbs is at
+                // most 2 less than the quotient.
+                //
+                template<class CppInt>
+                void divide_by_reciprocal(CppInt& q, CppInt& r, const CppInt& a, const CppInt& b, const CppInt& x) {
+                    using default_ops::eval_increment;
+                    using default_ops::eval_subtract;
+
+                    const unsigned n = b.size();
+                    CppInt t;
+                    divide_limb_slice(t, a, n - 1, a.size());
+                    eval_multiply(q, t, x);
+                    eval_right_shift(q, (n + 1) * CppInt::limb_bits);
+                    eval_multiply(t, q, b);
+                    eval_subtract(r, a, t);
+                    while (r.compare(b) >= 0) {
+                        eval_increment(q);
+                        eval_subtract(r, b);
+                    }
+                }
+
+                //
+                // Division of a by b with its most significant bit set: a is cut into blocks of n limbs and the
+                // blocks are divided from the most significant one on, each remainder is followed by the next
+                // block.  Each partial quotient has at most n limbs and goes to its place in q.
+                //
+                template<class CppInt>
+                void divide_normalized(CppInt* q, CppInt& r, const CppInt& a, const CppInt& b, limb_type v,
+                                       const CppInt* reciprocal) {
+                    const unsigned n = b.size();
+                    if (a.size() < n) {
+                        r = a;
+                        if (q)
+                            *q = static_cast<limb_type>(0u);
+                        return;
+                    }
+                    const unsigned blocks = a.size() > 2 * n ? (a.size() - n - 1) / n : 0;
+                    CppInt qb, t;
+                    if (q) {
+                        q->resize(a.size() - n + 1, a.size() - n + 1);
+                        std::fill(q->limbs(), q->limbs() + q->size(), static_cast<limb_type>(0u));
+                        q->sign(false);
+                    }
+                    for (unsigned i = blocks + 1; i-- > 0;) {
+                        if (i == blocks) {
+                            divide_limb_slice(t, a, i * n, a.size() - i * n);
+                        } else {
+                            t.swap(r);
+                            divide_limb_slice(qb, a, i * n, n);
+                            divide_limb_join(t, n, qb);
+                        }
+                        if (reciprocal)
+                            divide_by_reciprocal(qb, r, t, b, *reciprocal);
+                        else
+                            divide_recursive(qb, r, t, b, v);
+                        if (q)
+                            std::copy(qb.limbs(), qb.limbs() + qb.size(), q->limbs() + i * n);
+                    }
+                    if (q)
+                        q->normalize();
+                }
+
+                //
+                // Subquadratic division of a by b > 0 in place: a and b are shifted until the most significant bit of
+                // b is set, divided by the Newton reciprocal of b for large enough b and quotients and by
+                // Burnikel-Ziegler otherwise, and the remainder is shifted back.
+                //
+                template<class CppInt>
+                void divide_subquadratic(CppInt* q, CppInt& r, CppInt& a, CppInt& b) {
+                    const unsigned shift = CppInt::limb_bits - 1 -
+                                           nil::crypto3::multiprecision::detail::find_msb(b.limbs()[b.size() - 1]);
+                    eval_left_shift(a, shift);
+                    eval_left_shift(b, shift);
+                    if ((b.size() >= newton_division_cutoff) && (a.size() >= 4 * b.size())) {
+                        CppInt reciprocal;
+                        divide_newton_reciprocal(reciprocal, b);
+                        divide_normalized(q, r, a, b, limb_type(0), &reciprocal);
+                    } else {
+                        divide_normalized(q, r, a, b, divide_reciprocal_of(b), static_cast<const CppInt*>(nullptr));
+                    }
+                    eval_right_shift(r, shift);
+                }
+
+                //
+                // The magnitudes of x and y are copied to variable precision types for the subquadratic division
+                //
+                template<class CppInt1, class CppInt2, class CppInt3>
+                inline void divide_unsigned_subquadratic(CppInt1* result, const CppInt2& x, const CppInt3& y,
+                                                         CppInt1& r) {
+                    typedef cpp_int_backend<> working_type;
+
+                    const working_type x_t(x.limbs(), 0, x.size()), y_t(y.limbs(), 0, y.size());
+                    working_type a, b, q, rem;
+                    a = x_t;
+                    b = y_t;
+                    divide_subquadratic(result ? &q : nullptr, rem, a, b);
+                    if (result)
+                        *result = q;
+                    r = rem;
                 }
 
                 template<unsigned MinBits1,
@@ -574,13 +1048,11 @@ namespace nil {
                     eval_modulus(cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& result,
                                  const cpp_int_backend<MinBits2, MaxBits2, SignType2, Checked2, Allocator2>& a,
                                  const limb_type mod) {
-                    const int n = a.size();
-                    const double_limb_type two_n_mod =
-                        static_cast<limb_type>(1u) + (~static_cast<limb_type>(0u) - mod) % mod;
-                    limb_type res = a.limbs()[n - 1] % mod;
-
-                    for (int i = n - 2; i >= 0; --i)
-                        res = (res * two_n_mod + a.limbs()[i]) % mod;
+                    if (mod == 0) {
+                        BOOST_THROW_EXCEPTION(std::overflow_error("Integer Division by zero."));
+                    }
+                    const limb_type res =
+                        divide_limbs_by_limb(static_cast<limb_type*>(nullptr), 0, a.limbs(), a.size(), mod);
                     //
                     // We must not modify result until here in case
                     // result and a are the same object:
@@ -0,0 +1,155 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef BOOST_MULTIPRECISION_CPP_INT_DIVIDER_HPP
+#define BOOST_MULTIPRECISION_CPP_INT_DIVIDER_HPP
+
+namespace nil {
+    namespace crypto3 {
+        namespace multiprecision {
+            namespace backends {
+//
+// Minimum number of limbs in the divisor for the divider to keep its Newton reciprocal, each division then costs
+// two multiplications in the manner of Barrett:
+//
+#ifdef BOOST_MP_DIVIDER_BARRETT_CUTOFF
+                const size_t divider_barrett_cutoff = BOOST_MP_DIVIDER_BARRETT_CUTOFF;
+#else
+                const size_t divider_barrett_cutoff = 100;
+#endif
+            }    // namespace backends
+
+            /**
+             * Division by a fixed cpp_int divisor: the normalization shift of the divisor, the reciprocal of its
+             * leading limbs and, for large divisors, the reciprocal of the whole divisor are computed once and shared
+             * by all divisions. Single limb divisors divide one limb of the quotient per two multiplications, small
+             * ones go through the schoolbook division and large ones through Burnikel-Ziegler or Barrett. The
+             * results are those of operator/ and operator%, the quotient is truncated and the remainder has the sign
+             * of the dividend. Like operator/, a divider of zero, a default constructed one included, throws
+             * std::overflow_error.
+             */
+            template<typename Backend>
+            class divider {
+                typedef number<Backend> number_type;
+                typedef backends::cpp_int_backend<> working_type;
+
+            public:
+                divider() : m_shift(0), m_reciprocal(0), m_has_mu(false) {
+                }
+
+                template<typename Number>
+                explicit divider(const Number& d) {
+                    initialize_divider(number_type(d));
+                }
+
+                template<typename Number>
+                divider& operator=(const Number& d) {
+                    initialize_divider(number_type(d));
+                    return *this;
+                }
+
+                inline const number_type& divisor() const {
+                    return m_divisor;
+                }
+
+                inline number_type divide(const number_type& x) const {
+                    number_type q, r;
+                    divide_qr(x, q, r);
+                    return q;
+                }
+
+                inline number_type mod(const number_type& x) const {
+                    number_type r;
+                    divide_qr(x, static_cast<number_type*>(nullptr), r);
+                    return r;
+                }
+
+                inline void divide_qr(const number_type& x, number_type& q, number_type& r) const {
+                    divide_qr(x, &q, r);
+                }
+
+            protected:
+                inline void initialize_divider(const number_type& d) {
+                    using default_ops::eval_is_zero;
+
+                    if (eval_is_zero(d.backend())) {
+                        BOOST_THROW_EXCEPTION(std::overflow_error("Integer Division by zero."));
+                    }
+                    m_divisor = d;
+                    const working_type d_t(d.backend().limbs(), 0, d.backend().size());
+                    m_normalized = d_t;
+                    m_shift = working_type::limb_bits - 1 -
+                              detail::find_msb(m_normalized.limbs()[m_normalized.size() - 1]);
+                    eval_left_shift(m_normalized, m_shift);
+                    m_reciprocal = m_normalized.size() == 1 ?
+                                       backends::divide_reciprocal_2by1(m_normalized.limbs()[0]) :
+                                       backends::divide_reciprocal_of(m_normalized);
+                    m_has_mu = m_normalized.size() >= backends::divider_barrett_cutoff;
+                    if (m_has_mu) {
+                        backends::divide_newton_reciprocal(m_mu, m_normalized);
+                    }
+                }
+
+                inline void divide_qr(const number_type& x, number_type* q, number_type& r) const {
+                    using default_ops::eval_is_zero;
+
+                    /// a default constructed divider has no divisor yet
+                    if (eval_is_zero(m_divisor.backend())) {
+                        BOOST_THROW_EXCEPTION(std::overflow_error("Integer Division by zero."));
+                    }
+                    const bool q_sign = x.backend().sign() != m_divisor.backend().sign(), r_sign = x.backend().sign();
+                    if (m_normalized.size() == 1) {
+                        //
+                        // The quotient is written over the limbs of x as they are read, so q may be x:
+                        //
+                        const unsigned n = x.backend().size();
+                        limb_type* pq = nullptr;
+                        if (q) {
+                            q->backend().resize(n, n);
+                            pq = q->backend().limbs();
+                        }
+                        const limb_type rem = backends::divide_limbs_by_normalized_limb(
+                            pq, q ? n : 0, x.backend().limbs(), n, m_normalized.limbs()[0], m_reciprocal, m_shift);
+                        if (q) {
+                            q->backend().normalize();
+                            q->backend().sign(q_sign);
+                        }
+                        r.backend() = rem;
+                        r.backend().sign(r_sign);
+                        return;
+                    }
+                    working_type a, wq, wr;
+                    const working_type x_t(x.backend().limbs(), 0, x.backend().size());
+                    a = x_t;
+                    eval_left_shift(a, m_shift);
+                    if (m_normalized.size() < backends::burnikel_ziegler_cutoff) {
+                        backends::divide_schoolbook(q ? &wq : nullptr, wr, a, m_normalized, m_reciprocal);
+                    } else {
+                        backends::divide_normalized(q ? &wq : nullptr, wr, a, m_normalized, m_reciprocal,
+                                                    m_has_mu ? &m_mu : nullptr);
+                    }
+                    eval_right_shift(wr, m_shift);
+                    if (q) {
+                        q->backend() = wq;
+                        q->backend().sign(q_sign);
+                    }
+                    r.backend() = wr;
+                    r.backend().sign(r_sign);
+                }
+
+                number_type m_divisor;
+                unsigned m_shift;
+                working_type m_normalized, m_mu;
+                limb_type m_reciprocal;
+                bool m_has_mu;
+            };
+        }    // namespace multiprecision
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // BOOST_MULTIPRECISION_CPP_INT_DIVIDER_HPP
@@ -18,6 +18,12 @@ namespace nil {
     namespace crypto3 {
         namespace multiprecision {
             namespace backends {
+                //
+                // Operands of at least this count of limbs take the Lehmer algorithm for the Jacobi symbol, the
+                // smaller ones the binary one
+                //
+                constexpr const unsigned jacobi_lehmer_limbs_threshold = 3;
+
                 template<typename Backend>
                 constexpr int eval_jacobi(const Backend &a, const Backend &n) {
                     using default_ops::eval_divide;
@@ -78,6 +84,317 @@ namespace nil {
                     }
                     return J;
                 }
+
+                namespace detail {
+                    //
+                    // Binary Jacobi algorithm for odd y: the powers of two are stripped from x, the greater of the
+                    // two odd values is reduced by the lesser one, the symbol changes sign for every odd power of
+                    // two with y = 3, 5 mod 8 and by the quadratic reciprocity on every swap
+                    //
+                    template<typename Unsigned>
+                    BOOST_MP_CXX14_CONSTEXPR int eval_jacobi_binary(Unsigned x, Unsigned y) {
+                        int J = 1;
+                        while (x) {
+                            const unsigned shift = nil::crypto3::multiprecision::detail::find_lsb(x);
+                            x >>= shift;
+                            if ((shift & 1u) && ((y & 7u) == 3u || (y & 7u) == 5u)) {
+                                J = -J;
+                            }
+                            if (x < y) {
+                                const Unsigned t = x;
+                                x = y;
+                                y = t;
+                                if ((x & y & 3u) == 3u) {
+                                    J = -J;
+                                }
+                            }
+                            x -= y;
+                        }
+                        return y == 1u ? J : 0;
+                    }
+
+                    //
+                    // The Lehmer algorithm follows the remainder sequence r_0 = n, r_1 = a mod n, ... whose members
+                    // may be even. Writing r_k = 2^e_k * o_k with odd o_k, (r_(k + 1) / o_k) equals
+                    // (r_(k + 2) / o_(k + 1)) up to a sign which only depends on the parities of e_k and e_(k + 1)
+                    // and on o_k and o_(k + 1) mod 8, packed in a remainder_info.
+                    //
+                    typedef unsigned remainder_info;
+
+                    //
+                    // The remainder_info of a non zero r from its lowest limb, false if the limb has too many
+                    // trailing zeros for that
+                    //
+                    inline BOOST_MP_CXX14_CONSTEXPR bool find_remainder_info(limb_type low, remainder_info& info) {
+                        if (!low) {
+                            return false;
+                        }
+                        const unsigned shift = nil::crypto3::multiprecision::detail::find_lsb(low);
+                        if (shift + 3u > sizeof(limb_type) * CHAR_BIT) {
+                            return false;
+                        }
+                        info = static_cast<remainder_info>(((low >> shift) & 7u) | ((shift & 1u) << 3u));
+                        return true;
+                    }
+
+                    template<typename Backend>
+                    BOOST_MP_CXX14_CONSTEXPR remainder_info find_remainder_info(const Backend& r) {
+                        using default_ops::eval_bit_test;
+                        using default_ops::eval_lsb;
+
+                        remainder_info info = 0;
+                        if (!find_remainder_info(r.limbs()[0], info)) {
+                            const unsigned shift = eval_lsb(r);
+                            info = 1u | (eval_bit_test(r, shift + 1) ? 2u : 0u) |
+                                   (eval_bit_test(r, shift + 2) ? 4u : 0u) | ((shift & 1u) << 3u);
+                        }
+                        return info;
+                    }
+
+                    //
+                    // (r_(k + 1) / o_k) = (2 / o_k)^e_(k + 1) * (2 / o_(k + 1))^e_k *
+                    // (-1)^((o_k - 1) * (o_(k + 1) - 1) / 4) * (r_(k + 2) / o_(k + 1)) for r_(k + 1) != 0, p and q are
+                    // the infos of r_k and r_(k + 1)
+                    //
+                    inline BOOST_MP_CXX14_CONSTEXPR bool is_jacobi_sign_changed(remainder_info p, remainder_info q) {
+                        const bool is_two_p_negative = (p & 7u) == 3u || (p & 7u) == 5u;
+                        const bool is_two_q_negative = (q & 7u) == 3u || (q & 7u) == 5u;
+                        return (((q & 8u) && is_two_p_negative) != ((p & 8u) && is_two_q_negative)) !=
+                               ((p & q & 3u) == 3u);
+                    }
+
+                    //
+                    // The bits of x starting from the bit shift which fit a limb
+                    //
+                    template<typename Backend>
+                    BOOST_MP_CXX14_CONSTEXPR limb_type leading_limb_bits(const Backend& x, unsigned shift) {
+                        const unsigned index = shift / bits_per_limb, offset = shift % bits_per_limb;
+                        if (index >= x.size()) {
+                            return 0;
+                        }
+                        limb_type result = x.limbs()[index] >> offset;
+                        if (offset && index + 1 < x.size()) {
+                            result |= x.limbs()[index + 1] << (bits_per_limb - offset);
+                        }
+                        return result;
+                    }
+
+                    //
+                    // result = s * u + t * v for s and t of opposite signs and a known non negative result
+                    //
+                    template<typename Backend>
+                    BOOST_MP_CXX14_CONSTEXPR void eval_lehmer_combination(Backend& result, Backend& temp,
+                                                                          const Backend& u, signed_limb_type s,
+                                                                          const Backend& v, signed_limb_type t) {
+                        if (t <= 0) {
+                            eval_multiply(result, u, static_cast<limb_type>(s));
+                            eval_multiply(temp, v, static_cast<limb_type>(-t));
+                        } else {
+                            eval_multiply(result, v, static_cast<limb_type>(t));
+                            eval_multiply(temp, u, static_cast<limb_type>(-s));
+                        }
+                        eval_subtract(result, temp);
+                    }
+
+                    //
+                    // s * u is formed before t * v is subtracted, which takes a limb more than the operands: the
+                    // bounded types run the Lehmer algorithm in an unchecked fixed type of a limb more
+                    //
+                    template<typename Backend, bool IsBounded = (max_precision<Backend>::value != UINT_MAX)>
+                    struct jacobi_lehmer_backend {
+                        typedef Backend type;
+                    };
+
+                    template<typename Backend>
+                    struct jacobi_lehmer_backend<Backend, true> {
+                        static constexpr const unsigned bits = max_precision<Backend>::value + bits_per_limb;
+                        typedef cpp_int_backend<bits, bits, unsigned_magnitude, unchecked, void> type;
+                    };
+
+                    template<typename Backend>
+                    BOOST_MP_CXX14_CONSTEXPR double_limb_type to_double_limb(const Backend& x) {
+                        BOOST_ASSERT(x.size() <= 2);
+                        double_limb_type result = x.limbs()[0];
+                        if (x.size() == 2) {
+                            result |= static_cast<double_limb_type>(x.limbs()[1]) << bits_per_limb;
+                        }
+                        return result;
+                    }
+                }    // namespace detail
+
+                //
+                // Jacobi symbol (V / U) for 0 <= V < U and odd U by Lehmer's algorithm (Knuth, TAOCP vol. 2,
+                // 4.5.2, algorithm L): the quotients of the remainder sequence are found from the leading
+                // bits_per_limb - 2 bits of the operands while both bounds agree, the lowest limbs of the
+                // remainders are followed alongside to update the symbol, and the full operands are only combined
+                // once per batch of quotients. U and V are destroyed.
+                //
+                template<unsigned MinBits1, unsigned MaxBits1, cpp_integer_type SignType1, cpp_int_check_type Checked1,
+                         class Allocator1>
+                BOOST_MP_CXX14_CONSTEXPR int
+                    eval_jacobi_lehmer(cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& U,
+                                       cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& V) {
+                    using default_ops::eval_is_zero;
+                    using default_ops::eval_lsb;
+                    using default_ops::eval_msb;
+
+                    constexpr unsigned leading_bits = bits_per_limb - 2;
+
+                    cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1> t1, t2, t3;
+                    /// a zero info is not known yet, U = n is odd
+                    detail::remainder_info u_info = static_cast<detail::remainder_info>(U.limbs()[0] & 7u), v_info = 0;
+                    int J = 1;
+
+                    /// the invariant is (a / n) = J * (V / o), o is the odd part of U
+                    while (!eval_is_zero(V)) {
+                        if (U.size() <= 2) {
+                            eval_right_shift(U, eval_lsb(U));
+                            return J * detail::eval_jacobi_binary(detail::to_double_limb(V), detail::to_double_limb(U));
+                        }
+                        if (!v_info) {
+                            v_info = detail::find_remainder_info(V);
+                        }
+
+                        const unsigned shift = eval_msb(U) + 1 - leading_bits;
+                        signed_limb_type uh = static_cast<signed_limb_type>(detail::leading_limb_bits(U, shift));
+                        signed_limb_type vh = static_cast<signed_limb_type>(detail::leading_limb_bits(V, shift));
+                        signed_limb_type A = 1, B = 0, C = 0, D = 1;
+                        limb_type u_low = U.limbs()[0], v_low = V.limbs()[0];
+                        detail::remainder_info next_u_info = u_info, next_v_info = v_info;
+
+                        while (vh + C != 0 && vh + D != 0) {
+                            const signed_limb_type q = (uh + A) / (vh + C);
+                            if (q != (uh + B) / (vh + D)) {
+                                break;
+                            }
+                            if (detail::is_jacobi_sign_changed(next_u_info, next_v_info)) {
+                                J = -J;
+                            }
+                            /// the quotient is the one of the full operands, so the lowest limb of the remainder
+                            /// is known, the batch ends when its info is not
+                            const limb_type low = u_low - static_cast<limb_type>(q) * v_low;
+                            detail::remainder_info info = 0;
+                            detail::find_remainder_info(low, info);
+
+                            signed_limb_type t = A - q * C;
+                            A = C;
+                            C = t;
+                            t = B - q * D;
+                            B = D;
+                            D = t;
+                            t = uh - q * vh;
+                            uh = vh;
+                            vh = t;
+                            u_low = v_low;
+                            v_low = low;
+                            next_u_info = next_v_info;
+                            next_v_info = info;
+                            if (!info) {
+                                break;
+                            }
+                        }
+
+                        if (B == 0) {
+                            /// no quotient is known from the leading bits, a full division step is taken
+                            if (detail::is_jacobi_sign_changed(u_info, v_info)) {
+                                J = -J;
+                            }
+                            eval_modulus(t1, U, V);
+                            U.swap(V);
+                            V.swap(t1);
+                            u_info = v_info;
+                            v_info = 0;
+                        } else {
+                            detail::eval_lehmer_combination(t1, t3, U, A, V, B);
+                            detail::eval_lehmer_combination(t2, t3, U, C, V, D);
+                            U.swap(t1);
+                            V.swap(t2);
+                            u_info = next_u_info;
+                            v_info = next_v_info;
+                        }
+                    }
+                    /// U is the gcd of a and n now, hence odd
+                    return U.size() == 1 && U.limbs()[0] == 1u ? J : 0;
+                }
+
+                template<unsigned MinBits1, unsigned MaxBits1, cpp_integer_type SignType1, cpp_int_check_type Checked1,
+                         class Allocator1>
+                BOOST_MP_CXX14_CONSTEXPR typename std::enable_if<
+                    !is_trivial_cpp_int<cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>>::value,
+                    int>::type
+                    eval_jacobi(const cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& a,
+                                const cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& n) {
+                    using default_ops::eval_get_sign;
+                    using default_ops::eval_is_zero;
+                    using default_ops::eval_lsb;
+                    using default_ops::eval_msb;
+
+                    if (eval_get_sign(a) < 0) {
+                        BOOST_THROW_EXCEPTION(std::invalid_argument("jacobi: first argument must be non-negative"));
+                    }
+                    if (eval_get_sign(n) <= 0 || !(n.limbs()[0] & 1u) || (n.size() == 1 && n.limbs()[0] == 1u)) {
+                        BOOST_THROW_EXCEPTION(std::invalid_argument("jacobi: second argument must be odd and > 1"));
+                    }
+
+                    cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1> x(a), y(n);
+                    if (x.compare(y) >= 0) {
+                        eval_modulus(x, a, n);
+                    }
+
+#ifndef BOOST_MP_NO_CONSTEXPR_DETECTION
+                    if (!BOOST_MP_IS_CONST_EVALUATED(y.size()) && y.size() >= jacobi_lehmer_limbs_threshold)
+#else
+                    if (y.size() >= jacobi_lehmer_limbs_threshold)
+#endif
+                    {
+                        typedef typename detail::jacobi_lehmer_backend<
+                            cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>>::type lehmer_type;
+                        lehmer_type u(y), v(x);
+                        return eval_jacobi_lehmer(u, v);
+                    }
+
+                    /// binary algorithm on the limbs of x and y, y is odd, finished in a double limb
+                    int J = 1;
+                    while (x.size() > 2 || y.size() > 2) {
+                        if (eval_is_zero(x)) {
+                            return 0;
+                        }
+                        const unsigned shift = eval_lsb(x);
+                        if (shift) {
+                            custom_right_shift(x, shift);
+                            if ((shift & 1u) && ((y.limbs()[0] & 7u) == 3u || (y.limbs()[0] & 7u) == 5u)) {
+                                J = -J;
+                            }
+                        }
+                        if (x.compare(y) < 0) {
+                            x.swap(y);
+                            if ((x.limbs()[0] & y.limbs()[0] & 3u) == 3u) {
+                                J = -J;
+                            }
+                        }
+                        eval_subtract(x, y);
+                    }
+                    return J * detail::eval_jacobi_binary(detail::to_double_limb(x), detail::to_double_limb(y));
+                }
+
+                template<unsigned MinBits1, unsigned MaxBits1, cpp_integer_type SignType1, cpp_int_check_type Checked1,
+                         class Allocator1>
+                BOOST_MP_CXX14_CONSTEXPR typename std::enable_if<
+                    is_trivial_cpp_int<cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>>::value,
+                    int>::type
+                    eval_jacobi(const cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& a,
+                                const cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& n) {
+                    if (a.sign()) {
+                        BOOST_THROW_EXCEPTION(std::invalid_argument("jacobi: first argument must be non-negative"));
+                    }
+                    if (n.sign() || !(*n.limbs() & 1u) || *n.limbs() == 1u) {
+                        BOOST_THROW_EXCEPTION(std::invalid_argument("jacobi: second argument must be odd and > 1"));
+                    }
+                    typedef typename std::remove_cv<typename std::remove_reference<decltype(*n.limbs())>::type>::type
+                        local_limb_type;
+                    return detail::eval_jacobi_binary(static_cast<local_limb_type>(*a.limbs() % *n.limbs()),
+                                                      static_cast<local_limb_type>(*n.limbs()));
+                }
             }
         }    // namespace multiprecision
     }        // namespace crypto3
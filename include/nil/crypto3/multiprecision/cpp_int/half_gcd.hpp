@@ -0,0 +1,688 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef BOOST_MULTIPRECISION_CPP_INT_HALF_GCD_HPP
+#define BOOST_MULTIPRECISION_CPP_INT_HALF_GCD_HPP
+
+#include <nil/crypto3/multiprecision/detail/default_ops.hpp>
+#include <nil/crypto3/multiprecision/cpp_int/detail/extended_euclidean.hpp>
+
+#include <algorithm>
+
+namespace nil {
+    namespace crypto3 {
+        namespace multiprecision {
+            namespace backends {
+//
+// gcd and the extended Euclidean algorithm reduce the operands of at least gcd_half_gcd_threshold limbs with the
+// half-gcd. Inside the half-gcd the distances to the target size below half_gcd_threshold limbs are covered by
+// Lehmer steps instead of the recursion. The half-gcd breaks even with the Lehmer gcd at about 1536 limbs and saves
+// 15-20% from 2048 limbs on.
+//
+#ifdef BOOST_MP_GCD_HALF_GCD_THRESHOLD
+                constexpr const unsigned gcd_half_gcd_threshold = BOOST_MP_GCD_HALF_GCD_THRESHOLD;
+#else
+                constexpr const unsigned gcd_half_gcd_threshold = 1536;
+#endif
+#ifdef BOOST_MP_HALF_GCD_THRESHOLD
+                constexpr const unsigned half_gcd_threshold = BOOST_MP_HALF_GCD_THRESHOLD;
+#else
+                constexpr const unsigned half_gcd_threshold = 96;
+#endif
+//
+// The extended Euclidean algorithm and the inverse take Lehmer steps from gcdext_lehmer_threshold limbs on.
+//
+#ifdef BOOST_MP_GCDEXT_LEHMER_THRESHOLD
+                constexpr const unsigned gcdext_lehmer_threshold = BOOST_MP_GCDEXT_LEHMER_THRESHOLD;
+#else
+                constexpr const unsigned gcdext_lehmer_threshold = 2;
+#endif
+
+                //
+                // What follows is the subquadratic gcd of Schoenhage in the form given by Moller in "On Schoenhage's
+                // algorithm and subquadratic integer gcd computation", Math. Comp. 77 (2008), 589-607.
+                //
+                // The half-gcd of a, b takes Euclidean steps while both a and b stay at least 2^t and returns the
+                // matrix M of the steps: M has nonnegative entries, determinant 1 and (a, b) = M (a', b') for the
+                // reduced a', b'. Both reduced values being at least 2^t bounds the entries of M by max(a, b) / 2^t.
+                // Hence if a, b are the leading parts A >> p, B >> p of larger A, B and t > bits(a, b) / 2 + 1, then
+                // M^-1 (A, B) stays positive and at least 2^(p + t - 1): the steps found on the leading parts are valid
+                // for A and B. The recursion splits the distance n - t from the size n of a, b to the target in two
+                // halves, each is covered by the half-gcd of leading parts of about n - t bits.
+                //
+                namespace detail {
+                    template<typename Backend>
+                    struct half_gcd_matrix {
+                        half_gcd_matrix() {
+                            m[0][0] = static_cast<limb_type>(1u);
+                            m[0][1] = static_cast<limb_type>(0u);
+                            m[1][0] = static_cast<limb_type>(0u);
+                            m[1][1] = static_cast<limb_type>(1u);
+                        }
+
+                        void swap(half_gcd_matrix& o) {
+                            for (unsigned i = 0; i < 2; ++i) {
+                                for (unsigned j = 0; j < 2; ++j) {
+                                    m[i][j].swap(o.m[i][j]);
+                                }
+                            }
+                        }
+
+                        Backend m[2][2];
+                    };
+
+                    template<typename Backend>
+                    inline unsigned half_gcd_bits(const Backend& x) {
+                        using default_ops::eval_is_zero;
+                        using default_ops::eval_msb;
+
+                        return eval_is_zero(x) ? 0u : eval_msb(x) + 1u;
+                    }
+
+                    template<typename Backend>
+                    inline limb_type half_gcd_limb(const Backend& x, unsigned i) {
+                        return i < x.size() ? x.limbs()[i] : 0u;
+                    }
+
+                    //
+                    // Bits [p, p + 2 * bits_per_limb) of x
+                    //
+                    template<typename Backend>
+                    inline double_limb_type half_gcd_leading_bits(const Backend& x, unsigned p) {
+                        const unsigned index = p / bits_per_limb, shift = p % bits_per_limb;
+                        limb_type low = half_gcd_limb(x, index), high = half_gcd_limb(x, index + 1);
+                        if (shift) {
+                            low = (low >> shift) | (high << (bits_per_limb - shift));
+                            high = (high >> shift) | (half_gcd_limb(x, index + 2) << (bits_per_limb - shift));
+                        }
+                        return (static_cast<double_limb_type>(high) << bits_per_limb) | low;
+                    }
+
+                    //
+                    // u = q v + r for u >= v, most of the quotients are small
+                    //
+                    inline void half_gcd_divide(double_limb_type u, double_limb_type v, limb_type& q,
+                                                double_limb_type& r) {
+                        r = u - v;
+                        q = 1u;
+                        while (r >= v && q < 4u) {
+                            r -= v;
+                            ++q;
+                        }
+                        if (r >= v) {
+                            const double_limb_type d = r / v;
+                            q += static_cast<limb_type>(d);
+                            r -= d * v;
+                        }
+                    }
+
+                    //
+                    // Euclidean steps on the leading parts u = a >> p, v = b >> p of n - p <= 2 * bits_per_limb
+                    // bits, taken while both u and v stay at least 2^s, s = max(t - p + 1, n - p - bits_per_limb + 2).
+                    // Then the entries of the step matrix x are below 2^(bits_per_limb - 2), and for p > 0 the steps
+                    // are valid for a, b with x^-1 (a, b) at least 2^t. Returns false if no step is possible.
+                    //
+                    template<typename Backend>
+                    bool half_gcd_word_matrix(const Backend& a, const Backend& b, unsigned t, limb_type x[2][2]) {
+                        const unsigned n = (std::max)(half_gcd_bits(a), half_gcd_bits(b));
+                        const unsigned p = n > 2 * bits_per_limb ? n - 2 * bits_per_limb : 0;
+                        const unsigned s = (std::max)(t + 1 > p ? t + 1 - p : 0u,
+                                                      n - p + 2 > bits_per_limb ? n - p + 2 - bits_per_limb : 0u);
+                        if (s >= 2 * bits_per_limb) {
+                            return false;
+                        }
+
+                        double_limb_type u = half_gcd_leading_bits(a, p), v = half_gcd_leading_bits(b, p), r;
+                        if (!(u >> s) || !(v >> s)) {
+                            return false;
+                        }
+
+                        x[0][0] = x[1][1] = 1u;
+                        x[0][1] = x[1][0] = 0u;
+                        bool is_reduced = false;
+                        limb_type q;
+                        while (true) {
+                            if (u >= v) {
+                                half_gcd_divide(u, v, q, r);
+                                if (!(r >> s)) {
+                                    break;
+                                }
+                                u = r;
+                                x[0][1] += q * x[0][0];
+                                x[1][1] += q * x[1][0];
+                            } else {
+                                half_gcd_divide(v, u, q, r);
+                                if (!(r >> s)) {
+                                    break;
+                                }
+                                v = r;
+                                x[0][0] += q * x[0][1];
+                                x[1][0] += q * x[1][1];
+                            }
+                            is_reduced = true;
+                        }
+                        return is_reduced;
+                    }
+
+                    //
+                    // (a, b) = x^-1 (a, b) = (x11 a - x01 b, x00 b - x10 a) for nonnegative results in one pass over
+                    // the limbs
+                    //
+                    template<typename Backend>
+                    void half_gcd_apply_word_matrix(Backend& a, Backend& b, const limb_type x[2][2]) {
+                        const unsigned a_size = a.size(), b_size = b.size(), size = (std::max)(a_size, b_size);
+                        a.resize(size, size);
+                        b.resize(size, size);
+                        limb_type* pa = a.limbs();
+                        limb_type* pb = b.limbs();
+                        std::fill(pa + a_size, pa + size, static_cast<limb_type>(0u));
+                        std::fill(pb + b_size, pb + size, static_cast<limb_type>(0u));
+
+                        double_limb_type a_plus = 0, a_minus = 0, b_plus = 0, b_minus = 0, d;
+                        limb_type a_borrow = 0, b_borrow = 0;
+                        for (unsigned i = 0; i < size; ++i) {
+                            const limb_type ai = pa[i], bi = pb[i];
+                            a_plus += static_cast<double_limb_type>(x[1][1]) * ai;
+                            a_minus += static_cast<double_limb_type>(x[0][1]) * bi;
+                            b_plus += static_cast<double_limb_type>(x[0][0]) * bi;
+                            b_minus += static_cast<double_limb_type>(x[1][0]) * ai;
+
+                            /// a negative difference leaves all ones in the high limb
+                            d = static_cast<double_limb_type>(static_cast<limb_type>(a_plus)) -
+                                static_cast<limb_type>(a_minus) - a_borrow;
+                            pa[i] = static_cast<limb_type>(d);
+                            a_borrow = static_cast<limb_type>(d >> bits_per_limb) & 1u;
+                            d = static_cast<double_limb_type>(static_cast<limb_type>(b_plus)) -
+                                static_cast<limb_type>(b_minus) - b_borrow;
+                            pb[i] = static_cast<limb_type>(d);
+                            b_borrow = static_cast<limb_type>(d >> bits_per_limb) & 1u;
+
+                            a_plus >>= bits_per_limb;
+                            a_minus >>= bits_per_limb;
+                            b_plus >>= bits_per_limb;
+                            b_minus >>= bits_per_limb;
+                        }
+                        a.normalize();
+                        b.normalize();
+                    }
+
+                    //
+                    // (c0, c1) = (c0, c1) x = (x00 c0 + x10 c1, x01 c0 + x11 c1) for a row of a step matrix
+                    //
+                    template<typename Backend>
+                    void half_gcd_multiply_word_row(Backend& c0, Backend& c1, const limb_type x[2][2]) {
+                        const unsigned c0_size = c0.size(), c1_size = c1.size(),
+                                       size = (std::max)(c0_size, c1_size) + 1;
+                        c0.resize(size, size);
+                        c1.resize(size, size);
+                        limb_type* p0 = c0.limbs();
+                        limb_type* p1 = c1.limbs();
+                        std::fill(p0 + c0_size, p0 + size, static_cast<limb_type>(0u));
+                        std::fill(p1 + c1_size, p1 + size, static_cast<limb_type>(0u));
+
+                        /// the entries of x are below 2^(bits_per_limb - 2), the sums fit a double limb
+                        double_limb_type carry0 = 0, carry1 = 0;
+                        for (unsigned i = 0; i < size; ++i) {
+                            const limb_type l0 = p0[i], l1 = p1[i];
+                            carry0 += static_cast<double_limb_type>(x[0][0]) * l0;
+                            carry0 += static_cast<double_limb_type>(x[1][0]) * l1;
+                            carry1 += static_cast<double_limb_type>(x[0][1]) * l0;
+                            carry1 += static_cast<double_limb_type>(x[1][1]) * l1;
+                            p0[i] = static_cast<limb_type>(carry0);
+                            p1[i] = static_cast<limb_type>(carry1);
+                            carry0 >>= bits_per_limb;
+                            carry1 >>= bits_per_limb;
+                        }
+                        c0.normalize();
+                        c1.normalize();
+                    }
+
+                    //
+                    // m = m x
+                    //
+                    template<typename Backend>
+                    void half_gcd_multiply_word_matrix(half_gcd_matrix<Backend>& m, const limb_type x[2][2]) {
+                        half_gcd_multiply_word_row(m.m[0][0], m.m[0][1], x);
+                        half_gcd_multiply_word_row(m.m[1][0], m.m[1][1], x);
+                    }
+
+                    //
+                    // (a, b) = m^-1 (a, b) = (m11 a - m01 b, m00 b - m10 a)
+                    //
+                    template<typename Backend>
+                    void half_gcd_apply_matrix(Backend& a, Backend& b, const half_gcd_matrix<Backend>& m) {
+                        Backend ta, tb, t;
+                        eval_multiply(ta, m.m[1][1], a);
+                        eval_multiply(t, m.m[0][1], b);
+                        eval_subtract(ta, t);
+                        eval_multiply(tb, m.m[0][0], b);
+                        eval_multiply(t, m.m[1][0], a);
+                        eval_subtract(tb, t);
+                        a.swap(ta);
+                        b.swap(tb);
+                    }
+
+                    //
+                    // result = x mod 2^p
+                    //
+                    template<typename Backend>
+                    void half_gcd_low_bits(Backend& result, const Backend& x, unsigned p) {
+                        const unsigned size = (std::min)(x.size(), (p + bits_per_limb - 1) / bits_per_limb);
+                        if (!size) {
+                            result = static_cast<limb_type>(0u);
+                            return;
+                        }
+                        result.resize(size, size);
+                        std::copy(x.limbs(), x.limbs() + size, result.limbs());
+                        if (size * bits_per_limb > p) {
+                            result.limbs()[size - 1] &= (static_cast<limb_type>(1u) << (p % bits_per_limb)) - 1u;
+                        }
+                        result.sign(false);
+                        result.normalize();
+                    }
+
+                    //
+                    // (a, b) = m^-1 (a, b) for the leading parts (a >> p, b >> p) reduced to (a1, b1) by m:
+                    // m^-1 (a, b) = 2^p (a1, b1) + m^-1 (a mod 2^p, b mod 2^p), so only the low parts are multiplied
+                    //
+                    template<typename Backend>
+                    void half_gcd_lift(Backend& a, Backend& b, unsigned p, Backend& a1, Backend& b1,
+                                       const half_gcd_matrix<Backend>& m) {
+                        using default_ops::eval_left_shift;
+
+                        Backend a0, b0;
+                        half_gcd_low_bits(a0, a, p);
+                        half_gcd_low_bits(b0, b, p);
+                        half_gcd_apply_matrix(a0, b0, m);
+                        eval_left_shift(a1, p);
+                        eval_left_shift(b1, p);
+                        eval_add(a1, a0);
+                        eval_add(b1, b0);
+                        a.swap(a1);
+                        b.swap(b1);
+                    }
+
+                    //
+                    // (c0, c1) = (c0, c1) n for a row of a step matrix
+                    //
+                    template<typename Backend>
+                    void half_gcd_multiply_row(Backend& c0, Backend& c1, const half_gcd_matrix<Backend>& n) {
+                        Backend t0, t1, t;
+                        eval_multiply(t0, c0, n.m[0][0]);
+                        eval_multiply(t, c1, n.m[1][0]);
+                        eval_add(t0, t);
+                        eval_multiply(t1, c0, n.m[0][1]);
+                        eval_multiply(t, c1, n.m[1][1]);
+                        eval_add(t1, t);
+                        c0.swap(t0);
+                        c1.swap(t1);
+                    }
+
+                    //
+                    // m = m n
+                    //
+                    template<typename Backend>
+                    void half_gcd_multiply_matrix(half_gcd_matrix<Backend>& m, const half_gcd_matrix<Backend>& n) {
+                        half_gcd_multiply_row(m.m[0][0], m.m[0][1], n);
+                        half_gcd_multiply_row(m.m[1][0], m.m[1][1], n);
+                    }
+
+                    //
+                    // A Lehmer step on the leading limbs, or a single Euclidean step with a full division if the
+                    // quotient is too large for it. Both a and b stay at least 2^t, returns false if no step is
+                    // possible.
+                    //
+                    template<typename Backend>
+                    bool half_gcd_step(Backend& a, Backend& b, unsigned t, half_gcd_matrix<Backend>& m) {
+                        limb_type x[2][2];
+                        if (half_gcd_word_matrix(a, b, t, x)) {
+                            half_gcd_apply_word_matrix(a, b, x);
+                            half_gcd_multiply_word_matrix(m, x);
+                            return true;
+                        }
+
+                        /// (a, b) = (a - q b, b) is the step (a, b) = E (a - q b, b) with E = (1 q, 0 1)
+                        const bool is_a_reduced = a.compare(b) >= 0;
+                        Backend& x0 = is_a_reduced ? a : b;
+                        const Backend& x1 = is_a_reduced ? b : a;
+                        Backend q, r;
+                        divide_unsigned_helper(&q, x0, x1, r);
+                        if (half_gcd_bits(r) <= t) {
+                            return false;
+                        }
+                        x0.swap(r);
+
+                        const unsigned column = is_a_reduced ? 1 : 0;
+                        for (unsigned row = 0; row < 2; ++row) {
+                            eval_multiply(r, q, m.m[row][1 - column]);
+                            eval_add(m.m[row][column], r);
+                        }
+                        return true;
+                    }
+
+                    //
+                    // Half-gcd of a, b with the target 2^t, m should be the identity on entry. Returns false if no
+                    // step is possible.
+                    //
+                    template<typename Backend>
+                    bool eval_half_gcd(Backend& a, Backend& b, unsigned t, half_gcd_matrix<Backend>& m) {
+                        using default_ops::eval_right_shift;
+
+                        if (half_gcd_bits(a) <= t || half_gcd_bits(b) <= t) {
+                            return false;
+                        }
+
+                        bool is_reduced = false;
+                        unsigned d = (std::max)(half_gcd_bits(a), half_gcd_bits(b)) - t;
+                        if (d >= half_gcd_threshold * bits_per_limb && d < t) {
+                            /// the first half of the distance: the leading d bits are reduced to about d / 2 bits
+                            {
+                                Backend a1(a), b1(b);
+                                eval_right_shift(a1, t);
+                                eval_right_shift(b1, t);
+                                half_gcd_matrix<Backend> m1;
+                                if (eval_half_gcd(a1, b1, d / 2 + 2, m1)) {
+                                    half_gcd_lift(a, b, t, a1, b1, m1);
+                                    m.swap(m1);
+                                    is_reduced = true;
+                                }
+                            }
+
+                            /// single steps if the first half did not get far enough
+                            const unsigned half_distance = 3 * d / 4;
+                            while ((std::max)(half_gcd_bits(a), half_gcd_bits(b)) - t > half_distance) {
+                                if (!half_gcd_step(a, b, t, m)) {
+                                    return is_reduced;
+                                }
+                                is_reduced = true;
+                            }
+
+                            /// the second half: the leading 2d + 1 bits are reduced to d + 2 bits, that is 2^t for a, b
+                            d = (std::max)(half_gcd_bits(a), half_gcd_bits(b)) - t;
+                            if (d >= half_gcd_threshold * bits_per_limb) {
+                                const unsigned p = t - d - 1;
+                                Backend a2(a), b2(b);
+                                eval_right_shift(a2, p);
+                                eval_right_shift(b2, p);
+                                half_gcd_matrix<Backend> m2;
+                                if (eval_half_gcd(a2, b2, d + 2, m2)) {
+                                    half_gcd_lift(a, b, p, a2, b2, m2);
+                                    half_gcd_multiply_matrix(m, m2);
+                                    is_reduced = true;
+                                }
+                            }
+                        }
+
+                        while (half_gcd_step(a, b, t, m)) {
+                            is_reduced = true;
+                        }
+                        return is_reduced;
+                    }
+
+                    //
+                    // The half-gcd step of the leading two thirds of u, v, which removes about a third of their bits.
+                    // Returns false if the sizes of u and v are too far apart or no step is possible.
+                    //
+                    template<typename Backend>
+                    bool half_gcd_reduce_step(Backend& u, Backend& v, half_gcd_matrix<Backend>& m) {
+                        using default_ops::eval_right_shift;
+
+                        const unsigned u_bits = half_gcd_bits(u), v_bits = half_gcd_bits(v);
+                        const unsigned n = (std::max)(u_bits, v_bits), p = n / 3;
+                        if (n - (std::min)(u_bits, v_bits) >= p) {
+                            return false;
+                        }
+                        Backend a(u), b(v);
+                        eval_right_shift(a, p);
+                        eval_right_shift(b, p);
+                        if (!eval_half_gcd(a, b, (n - p) / 2 + 2, m)) {
+                            return false;
+                        }
+                        half_gcd_lift(u, v, p, a, b, m);
+                        return true;
+                    }
+
+                    //
+                    // Reduces u >= v > 0 until v has less than gcd_half_gcd_threshold limbs, keeping u >= v and
+                    // gcd(u, v). The half-gcd steps are taken while u and v are of about the same size, a division
+                    // step otherwise.
+                    //
+                    template<typename Backend>
+                    void eval_gcd_half_gcd_reduce(Backend& u, Backend& v) {
+                        Backend q, r;
+                        while (v.size() >= gcd_half_gcd_threshold) {
+                            half_gcd_matrix<Backend> m;
+                            if (!half_gcd_reduce_step(u, v, m)) {
+                                /// (u, v) = (v, u - q v)
+                                divide_unsigned_helper(&q, u, v, r);
+                                u.swap(v);
+                                v.swap(r);
+                            }
+                            if (u.compare(v) < 0) {
+                                u.swap(v);
+                            }
+                        }
+                    }
+
+                    //
+                    // g = gcd(a, b) and x = a^-1 g mod b for a, b > 0, that is g = a x + b y for some y. The steps
+                    // are collected in the matrix M with (a, b) = M (u, v) for the current u, v, only its second
+                    // row (c0, c1) is kept. Since M^-1 = (m11, -m01; -m10, m00), v = m00 b - c0 a and u = c1 a - m01 b.
+                    // Small operands are reduced by Lehmer steps on the leading two limbs, which leave multi-precision
+                    // divisions to the rare large quotients and update both cofactors in a single pass.
+                    //
+                    template<typename Backend>
+                    void eval_gcd_cofactor(Backend& g, Backend& x, const Backend& a, const Backend& b) {
+                        using default_ops::eval_is_zero;
+
+                        Backend u(a), v(b), c0, c1, q, r;
+                        c0 = static_cast<limb_type>(0u);
+                        c1 = static_cast<limb_type>(1u);
+                        limb_type w[2][2];
+                        while (true) {
+                            if ((std::min)(u.size(), v.size()) >= gcd_half_gcd_threshold) {
+                                half_gcd_matrix<Backend> m;
+                                if (half_gcd_reduce_step(u, v, m)) {
+                                    half_gcd_multiply_row(c0, c1, m);
+                                    continue;
+                                }
+                            }
+                            if (half_gcd_word_matrix(u, v, 0, w)) {
+                                half_gcd_apply_word_matrix(u, v, w);
+                                half_gcd_multiply_word_row(c0, c1, w);
+                                continue;
+                            }
+
+                            const bool is_u_reduced = u.compare(v) >= 0;
+                            Backend& x0 = is_u_reduced ? u : v;
+                            const Backend& x1 = is_u_reduced ? v : u;
+                            divide_unsigned_helper(&q, x0, x1, r);
+                            if (eval_is_zero(r)) {
+                                /// x1 divides x0 and is the gcd
+                                g = x1;
+                                if (is_u_reduced) {
+                                    x = c0;
+                                    x.negate();
+                                } else {
+                                    x = c1;
+                                }
+                                return;
+                            }
+                            x0.swap(r);
+                            /// (u, v) = E (u', v') with E = (1 q, 0 1) or E = (1 0, q 1) and the row of M E
+                            eval_multiply(r, q, is_u_reduced ? c0 : c1);
+                            eval_add(is_u_reduced ? c1 : c0, r);
+                        }
+                    }
+
+                    //
+                    // g = gcd(a, b) = a x + b y for a, b > 0, y is found by an exact division. The cofactor is
+                    // only known modulo b / g, x is brought to (-b / 2g, b / 2g] to get the unique cofactors the
+                    // generic algorithm and mpz_gcdext return.
+                    //
+                    template<typename Backend>
+                    void eval_extended_gcd(Backend& g, Backend& x, Backend& y, const Backend& a, const Backend& b) {
+                        Backend r, t;
+                        eval_gcd_cofactor(g, x, a, b);
+
+                        divide_unsigned_helper(&r, b, g, t);
+                        t = x;
+                        eval_left_shift(t, 1u);
+                        if (t.compare(r) > 0) {
+                            eval_subtract(x, r);
+                        } else {
+                            t.negate();
+                            if (t.compare(r) >= 0) {
+                                eval_add(x, r);
+                            }
+                        }
+
+                        eval_multiply(t, a, x);
+                        eval_subtract(r, g, t);
+                        divide_unsigned_helper(&y, r, b, t);
+                        y.sign(r.sign());
+                    }
+                }    // namespace detail
+
+                //
+                // Reduction of the gcd operands U >= V > 0 by the half-gcd, the result is left in U, V with V below
+                // gcd_half_gcd_threshold limbs. The reduction runs on a variable precision copy.
+                //
+                template<unsigned MinBits1,
+                         unsigned MaxBits1,
+                         cpp_integer_type SignType1,
+                         cpp_int_check_type Checked1,
+                         class Allocator1>
+                void eval_gcd_half_gcd_reduce(cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& U,
+                                              cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& V) {
+                    typedef cpp_int_backend<> working_type;
+
+                    /// U and V may alias a shared storage, the copies are assigned to get storages of their own
+                    working_type u, v;
+                    u = U;
+                    v = V;
+                    detail::eval_gcd_half_gcd_reduce(u, v);
+                    U = u;
+                    V = v;
+                }
+
+                //
+                // The Lehmer and half-gcd parts of the extended Euclidean algorithm and the inverse below, kept apart
+                // from them as they can not be constexpr
+                //
+                template<unsigned MinBits1,
+                         unsigned MaxBits1,
+                         cpp_integer_type SignType1,
+                         cpp_int_check_type Checked1,
+                         class Allocator1>
+                cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1> eval_extended_euclidean_lehmer(
+                    const cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& num1,
+                    const cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& num2,
+                    cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& bezout_x,
+                    cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& bezout_y) {
+                    typedef cpp_int_backend<> working_type;
+
+                    working_type a, b, g, x, y;
+                    a = num1;
+                    b = num2;
+                    detail::eval_extended_gcd(g, x, y, a, b);
+                    bezout_x = x;
+                    bezout_y = y;
+                    cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1> result;
+                    result = g;
+                    return result;
+                }
+
+                template<unsigned MinBits1,
+                         unsigned MaxBits1,
+                         cpp_integer_type SignType1,
+                         cpp_int_check_type Checked1,
+                         class Allocator1>
+                void eval_inverse_lehmer(cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& result,
+                                         const cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& a,
+                                         const cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& m) {
+                    typedef cpp_int_backend<> working_type;
+
+                    working_type aa, mm, g, x;
+                    aa = a;
+                    mm = m;
+                    detail::eval_gcd_cofactor(g, x, aa, mm);
+                    if (!eval_eq(g, static_cast<limb_type>(1u))) {
+                        result = static_cast<limb_type>(0u);
+                        return;
+                    }
+                    /// |x| < m, a negative x is brought to [0, m)
+                    if (x.sign()) {
+                        eval_add(x, mm);
+                    }
+                    result = x;
+                }
+
+                //
+                // Extended Euclidean algorithm for cpp_int: the Lehmer and half-gcd steps for positive operands of
+                // at least gcdext_lehmer_threshold limbs, the generic algorithm otherwise
+                //
+                template<unsigned MinBits1,
+                         unsigned MaxBits1,
+                         cpp_integer_type SignType1,
+                         cpp_int_check_type Checked1,
+                         class Allocator1>
+                inline BOOST_MP_CXX14_CONSTEXPR cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>
+                    eval_extended_euclidean_algorithm(
+                        cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& num1,
+                        cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& num2,
+                        cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& bezout_x,
+                        cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& bezout_y) {
+                    typedef cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1> backend_type;
+                    using default_ops::eval_get_sign;
+
+                    if (SignType1 == signed_magnitude &&
+                        (std::max)(num1.size(), num2.size()) >= gcdext_lehmer_threshold &&
+#ifndef BOOST_MP_NO_CONSTEXPR_DETECTION
+                        !BOOST_MP_IS_CONST_EVALUATED(num1.size()) &&
+#endif
+                        eval_get_sign(num1) > 0 && eval_get_sign(num2) > 0) {
+                        return eval_extended_euclidean_lehmer(num1, num2, bezout_x, bezout_y);
+                    }
+                    /// the generic algorithm
+                    return eval_extended_euclidean_algorithm<backend_type>(num1, num2, bezout_x, bezout_y);
+                }
+
+                //
+                // a^-1 mod m for cpp_int, or 0 if a is not invertible. Only the cofactor of a is computed, by the
+                // Lehmer and half-gcd steps for positive a and m of at least gcdext_lehmer_threshold limbs.
+                //
+                template<unsigned MinBits1,
+                         unsigned MaxBits1,
+                         cpp_integer_type SignType1,
+                         cpp_int_check_type Checked1,
+                         class Allocator1>
+                inline BOOST_MP_CXX14_CONSTEXPR void eval_inverse_extended_euclidean_algorithm(
+                    cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& result,
+                    const cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& a,
+                    const cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& m) {
+                    typedef cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1> backend_type;
+                    using default_ops::eval_get_sign;
+
+                    if ((std::max)(a.size(), m.size()) >= gcdext_lehmer_threshold &&
+#ifndef BOOST_MP_NO_CONSTEXPR_DETECTION
+                        !BOOST_MP_IS_CONST_EVALUATED(a.size()) &&
+#endif
+                        eval_get_sign(a) > 0 && eval_get_sign(m) > 0) {
+                        eval_inverse_lehmer(result, a, m);
+                        return;
+                    }
+                    /// the generic algorithm
+                    eval_inverse_extended_euclidean_algorithm<backend_type>(result, a, m);
+                }
+            }    // namespace backends
+        }        // namespace multiprecision
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // BOOST_MULTIPRECISION_CPP_INT_HALF_GCD_HPP
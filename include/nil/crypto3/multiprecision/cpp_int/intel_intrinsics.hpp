@@ -96,6 +96,32 @@ namespace nil {
                     return BOOST_JOIN(BOOST_MP_SUBB, 64)(carry, a, b, reinterpret_cast<cast_type*>(p_result));
                 }
 
+//
+// mulx and adcx/adox are available only when the target enables BMI2 and ADX (e.g. -mbmi2 -madx or -march=native):
+//
+#if defined(__BMI2__) && defined(__ADX__)
+#define BOOST_MP_HAS_MULX_ADX
+
+                BOOST_MP_FORCEINLINE limb_type mulx_limb(limb_type a, limb_type b, limb_type* p_high) {
+#ifdef BOOST_INTEL
+                    using cast_type = unsigned __int64;
+#else
+                    using cast_type = unsigned long long;
+#endif
+                    return _mulx_u64(a, b, reinterpret_cast<cast_type*>(p_high));
+                }
+
+                BOOST_MP_FORCEINLINE unsigned char addcarryx_limb(unsigned char carry, limb_type a, limb_type b,
+                                                                  limb_type* p_result) {
+#ifdef BOOST_INTEL
+                    using cast_type = unsigned __int64;
+#else
+                    using cast_type = unsigned long long;
+#endif
+                    return _addcarryx_u64(carry, a, b, reinterpret_cast<cast_type*>(p_result));
+                }
+#endif
+
             }    // namespace detail
         }        // namespace multiprecision
     }            // namespace crypto3
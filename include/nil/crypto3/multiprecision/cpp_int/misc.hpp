@@ -508,14 +508,9 @@ namespace nil {
                                          Integer mod) {
                     BOOST_IF_CONSTEXPR(sizeof(Integer) <= sizeof(limb_type)) {
                         if (mod <= (std::numeric_limits<limb_type>::max)()) {
-                            const int n = a.size();
-                            const double_limb_type two_n_mod =
-                                static_cast<limb_type>(1u) + (~static_cast<limb_type>(0u) - mod) % mod;
-                            limb_type res = a.limbs()[n - 1] % mod;
-
-                            for (int i = n - 2; i >= 0; --i)
-                                res = static_cast<limb_type>((res * two_n_mod + a.limbs()[i]) % mod);
-                            return res;
+                            return static_cast<Integer>(divide_limbs_by_limb(static_cast<limb_type*>(nullptr), 0,
+                                                                             a.limbs(), a.size(),
+                                                                             static_cast<limb_type>(mod)));
                         } else
                             return default_ops::eval_integer_modulus(a, mod);
                     }
@@ -1201,6 +1196,18 @@ namespace nil {
                     if (U.compare(V) < 0)
                         U.swap(V);
 
+                    //
+                    // Large operands are reduced by the subquadratic half-gcd first:
+                    //
+#ifndef BOOST_MP_NO_CONSTEXPR_DETECTION
+                    if (!BOOST_MP_IS_CONST_EVALUATED(U.size()) && (V.size() >= gcd_half_gcd_threshold))
+#else
+                    if (V.size() >= gcd_half_gcd_threshold)
+#endif
+                    {
+                        eval_gcd_half_gcd_reduce(U, V);
+                    }
+
                     while (!eval_is_zero(V)) {
                         if (U.size() <= 2) {
                             //
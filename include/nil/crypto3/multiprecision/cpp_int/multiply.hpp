@@ -11,6 +11,7 @@
 #define BOOST_MP_CPP_INT_MUL_HPP
 
 #include <nil/crypto3/multiprecision/integer.hpp>
+#include <nil/crypto3/multiprecision/cpp_int/ntt.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -98,6 +99,42 @@ namespace nil {
 #else
                 const size_t karatsuba_cutoff = 40;
 #endif
+//
+// Minimum number of limbs for Karatsuba squaring, the schoolbook square is cheaper so this is tuned on its own:
+//
+#ifdef BOOST_MP_KARATSUBA_SQUARE_CUTOFF
+                const size_t karatsuba_square_cutoff = BOOST_MP_KARATSUBA_SQUARE_CUTOFF;
+#else
+                const size_t karatsuba_square_cutoff = 40;
+#endif
+//
+// Minimum number of limbs required in both arguments for the Toom-Cook tiers to replace Karatsuba,
+// Toom-3 (and its unbalanced variants) first, then Toom-4 for balanced arguments:
+//
+#ifdef BOOST_MP_TOOM3_CUTOFF
+                const size_t toom3_cutoff = BOOST_MP_TOOM3_CUTOFF;
+#else
+                const size_t toom3_cutoff = 150;
+#endif
+#ifdef BOOST_MP_TOOM4_CUTOFF
+                const size_t toom4_cutoff = BOOST_MP_TOOM4_CUTOFF;
+#else
+                const size_t toom4_cutoff = 400;
+#endif
+//
+// Minimum number of limbs required in both arguments for the NTT multiplication to replace Toom-Cook:
+//
+#ifdef BOOST_MP_HAS_NTT_MULTIPLY
+#ifdef BOOST_MP_NTT_CUTOFF
+                const size_t ntt_cutoff = BOOST_MP_NTT_CUTOFF;
+#else
+                const size_t ntt_cutoff = 1500;
+#endif
+#endif
+
+                template<class CppInt>
+                inline void multiply_toom_cook(CppInt& result, const CppInt& a, const CppInt& b,
+                                               typename CppInt::scoped_shared_storage& storage);
                 //
                 // Core (recursive) Karatsuba multiplication, all the storage required is allocated upfront and
                 // passed down the stack in this routine.  Note that all the cpp_int_backend's must be the same type
@@ -118,13 +155,27 @@ namespace nil {
                     unsigned bs = b.size();
                     //
                     // Termination condition: if either argument is smaller than karatsuba_cutoff
-                    // then schoolboy multiplication will be faster:
+                    // then schoolboy multiplication will be faster.  Squares, which a and b may be as
+                    // distinct aliases of the same limbs, have their own cutoff:
                     //
-                    if ((as < karatsuba_cutoff) || (bs < karatsuba_cutoff)) {
+                    const bool square = (a.limbs() == b.limbs()) && (as == bs);
+                    if (square) {
+                        if (as < karatsuba_square_cutoff) {
+                            eval_square(result, a);
+                            return;
+                        }
+                    } else if ((as < karatsuba_cutoff) || (bs < karatsuba_cutoff)) {
                         eval_multiply(result, a, b);
                         return;
                     }
                     //
+                    // Above toom3_cutoff the Toom-Cook tiers take over, they recurse back into this routine:
+                    //
+                    if ((as >= toom3_cutoff) && (bs >= toom3_cutoff)) {
+                        multiply_toom_cook(result, a, b, storage);
+                        return;
+                    }
+                    //
                     // Partitioning size: split the larger of a and b into 2 halves
                     //
                     unsigned n = (as > bs ? as : bs) / 2 + 1;
@@ -195,11 +246,15 @@ namespace nil {
                     for (unsigned i = result_high.size() + 2 * n; i < result.size(); ++i)
                         result.limbs()[i] = 0;
                     //
-                    // Now calculate (a_h+a_l)*(b_h+b_l):
+                    // Now calculate (a_h+a_l)*(b_h+b_l), for a square the two sums are the same:
                     //
                     add_unsigned(t2, a_l, a_h);
-                    add_unsigned(t3, b_l, b_h);
-                    multiply_karatsuba(t1, t2, t3, storage);    // t1 = (a_h+a_l)*(b_h+b_l)
+                    if (square) {
+                        multiply_karatsuba(t1, t2, t2, storage);    // t1 = (a_h+a_l)^2
+                    } else {
+                        add_unsigned(t3, b_l, b_h);
+                        multiply_karatsuba(t1, t2, t3, storage);    // t1 = (a_h+a_l)*(b_h+b_l)
+                    }
                     //
                     // There is now a slight deviation from Karatsuba, we want to subtract
                     // a_l*b_l + a_h*b_h from t1, but rather than use an addition and a subtraction
@@ -225,6 +280,422 @@ namespace nil {
                     result.normalize();
                 }
 
+                //
+                // Toom-Cook multiplication: a and b are split into k and l parts of n limbs, evaluated as polynomials
+                // at k + l - 1 points, the values multiplied recursively and the product interpolated back from
+                // them.  As with Karatsuba, all the temporaries live in the shared storage and the parts are aliases
+                // of the limbs of the arguments.  The evaluation points are 0, 1, -1, -2, 2, 3 and infinity, the
+                // products at 0 and infinity are formed directly in place in result.
+                //
+                template<class CppInt>
+                inline CppInt toom_part(const CppInt& x, unsigned i, unsigned n, const limb_type& zero) {
+                    //
+                    // Alias part i of x, parts past the end of x are zero:
+                    //
+                    unsigned offset = i * n;
+                    CppInt result(offset < x.size() ? x.limbs() + offset : &zero, 0,
+                                  offset < x.size() ? (std::min)(n, x.size() - offset) : 1);
+                    result.normalize();
+                    return result;
+                }
+
+                template<class CppInt>
+                inline void toom_evaluate(CppInt& result, const CppInt* parts, unsigned k, limb_type point,
+                                          bool negative) {
+                    //
+                    // Horner's rule at point (or -point), the values are signed:
+                    //
+                    result = parts[k - 1];
+                    for (unsigned i = k - 1; i-- > 0;) {
+                        if (point != 1)
+                            eval_multiply(result, result, point);
+                        if (negative)
+                            result.negate();
+                        eval_add(result, result, parts[i]);
+                    }
+                }
+
+                template<class CppInt>
+                inline bool toom_is_square(const CppInt& a, const CppInt& b) {
+                    //
+                    // Squares only need the values of one argument, the other is the same limbs:
+                    //
+                    return (a.limbs() == b.limbs()) && (a.size() == b.size());
+                }
+
+                template<class CppInt>
+                inline void toom_multiply(CppInt& result, const CppInt& a, const CppInt& b,
+                                          typename CppInt::scoped_shared_storage& storage) {
+                    result.resize(a.size() + b.size(), a.size() + b.size());
+                    multiply_karatsuba(result, a, b, storage);
+                    result.sign(a.sign() != b.sign());
+                }
+
+                template<class CppInt>
+                inline void toom_divide_exact(CppInt& x, limb_type d) {
+                    //
+                    // Interpolation only ever divides exactly by small constants: the odd part of d is divided
+                    // out limb by limb with its inverse modulo the limb base, the power of 2 by a shift.
+                    //
+                    unsigned shift = 0;
+                    for (; !(d & 1u); d >>= 1)
+                        ++shift;
+                    typename CppInt::limb_pointer p = x.limbs();
+                    unsigned size = x.size();
+                    if (d != 1) {
+                        // d * d == 1 mod 8, each Newton step doubles the number of correct bits:
+                        limb_type inverse = d;
+                        for (unsigned i = 0; i < 5; ++i)
+                            inverse *= 2 - d * inverse;
+                        limb_type borrow = 0;
+                        for (unsigned i = 0; i < size; ++i) {
+                            limb_type s = p[i] - borrow;
+                            borrow = s > p[i];
+                            p[i] = s * inverse;
+                            borrow += static_cast<limb_type>((static_cast<double_limb_type>(p[i]) * d) >>
+                                                             CppInt::limb_bits);
+                        }
+                        BOOST_ASSERT(borrow == 0);
+                    }
+                    if (shift) {
+                        BOOST_ASSERT((p[0] & ((static_cast<limb_type>(1u) << shift) - 1)) == 0);
+                        for (unsigned i = 0; i + 1 < size; ++i)
+                            p[i] = (p[i] >> shift) | (p[i + 1] << (CppInt::limb_bits - shift));
+                        p[size - 1] >>= shift;
+                    }
+                    x.normalize();
+                    x.sign(x.sign());
+                }
+
+                template<class CppInt>
+                inline void toom_add_coefficient(CppInt& result, const CppInt& c, unsigned offset) {
+                    //
+                    // Every coefficient of the product is non-negative and the partial sums never exceed
+                    // the product, so the addition needs no extra limbs:
+                    //
+                    BOOST_ASSERT(!c.sign());
+                    CppInt result_alias(result.limbs(), offset, result.size() - offset);
+                    add_unsigned(result_alias, result_alias, c);
+                }
+
+                template<class CppInt>
+                inline void toom_multiply_ends(CppInt& result, CppInt& r0, CppInt& rinf, const CppInt& a_low,
+                                               const CppInt& b_low, const CppInt& a_high, const CppInt& b_high,
+                                               unsigned top, typename CppInt::scoped_shared_storage& storage) {
+                    //
+                    // The values at 0 and infinity are the lowest and highest coefficients, r0 and rinf alias
+                    // result below and above top, multiply straight into them and clear the limbs in between:
+                    //
+                    toom_multiply(r0, a_low, b_low, storage);
+                    for (unsigned i = r0.size(); i < top; ++i)
+                        result.limbs()[i] = 0;
+                    toom_multiply(rinf, a_high, b_high, storage);
+                    for (unsigned i = rinf.size() + top; i < result.size(); ++i)
+                        result.limbs()[i] = 0;
+                }
+
+                //
+                // Toom-3 for balanced arguments (k = l = 3) and Toom-42 for arguments about 2:1 (k = 4, l = 2),
+                // both have a product of degree 4 and share the points 0, 1, -1, -2, infinity and the
+                // interpolation sequence of Bodrato:
+                //
+                template<class CppInt>
+                inline void multiply_toom_5_points(CppInt& result, const CppInt& a, const CppInt& b, unsigned k,
+                                                   unsigned l, unsigned n,
+                                                   typename CppInt::scoped_shared_storage& storage) {
+                    BOOST_ASSERT((a.size() > (k - 1) * n) && (b.size() > (l - 1) * n));
+                    limb_type zero = 0;
+                    const CppInt a_parts[4] = {toom_part(a, 0, n, zero), toom_part(a, 1, n, zero),
+                                               toom_part(a, 2, n, zero), toom_part(a, 3, n, zero)};
+                    const CppInt b_parts[3] = {toom_part(b, 0, n, zero), toom_part(b, 1, n, zero),
+                                               toom_part(b, 2, n, zero)};
+
+                    CppInt a1(storage, n + 2), am1(storage, n + 2), am2(storage, n + 2);
+                    CppInt b1(storage, n + 2), bm1(storage, n + 2), bm2(storage, n + 2);
+                    CppInt r1(storage, 2 * n + 4), rm1(storage, 2 * n + 4), rm2(storage, 2 * n + 4);
+
+                    unsigned top = 4 * n;
+                    CppInt r0(result.limbs(), 0, top), rinf(result.limbs(), top, result.size() - top);
+                    toom_multiply_ends(result, r0, rinf, a_parts[0], b_parts[0], a_parts[k - 1], b_parts[l - 1], top,
+                                       storage);
+
+                    toom_evaluate(a1, a_parts, k, 1, false);
+                    toom_evaluate(am1, a_parts, k, 1, true);
+                    toom_evaluate(am2, a_parts, k, 2, true);
+                    if (toom_is_square(a, b)) {
+                        toom_multiply(r1, a1, a1, storage);
+                        toom_multiply(rm1, am1, am1, storage);
+                        toom_multiply(rm2, am2, am2, storage);
+                    } else {
+                        toom_evaluate(b1, b_parts, l, 1, false);
+                        toom_evaluate(bm1, b_parts, l, 1, true);
+                        toom_evaluate(bm2, b_parts, l, 2, true);
+                        toom_multiply(r1, a1, b1, storage);
+                        toom_multiply(rm1, am1, bm1, storage);
+                        toom_multiply(rm2, am2, bm2, storage);
+                    }
+                    //
+                    // r3 = (r(-2) - r(1)) / 3, r1 = (r(1) - r(-1)) / 2, r2 = r(-1) - r(0):
+                    //
+                    eval_subtract(rm2, rm2, r1);
+                    toom_divide_exact(rm2, 3);
+                    eval_subtract(r1, r1, rm1);
+                    toom_divide_exact(r1, 2);
+                    eval_subtract(rm1, rm1, r0);
+                    //
+                    // r3 = (r2 - r3) / 2 + 2 r(inf), r2 = r2 + r1 - r(inf), r1 = r1 - r3:
+                    //
+                    eval_subtract(rm2, rm2, rm1);
+                    rm2.negate();
+                    toom_divide_exact(rm2, 2);
+                    eval_add(rm2, rm2, rinf);
+                    eval_add(rm2, rm2, rinf);
+                    eval_add(rm1, rm1, r1);
+                    eval_subtract(rm1, rm1, rinf);
+                    eval_subtract(r1, r1, rm2);
+
+                    toom_add_coefficient(result, r1, n);
+                    toom_add_coefficient(result, rm1, 2 * n);
+                    toom_add_coefficient(result, rm2, 3 * n);
+
+                    storage.deallocate(6 * (n + 2) + 3 * (2 * n + 4));
+                    result.normalize();
+                }
+
+                //
+                // Toom-32 for arguments about 3:2, the product has degree 3 and the points 0, 1, -1, infinity
+                // suffice:
+                //
+                template<class CppInt>
+                inline void multiply_toom32(CppInt& result, const CppInt& a, const CppInt& b, unsigned n,
+                                            typename CppInt::scoped_shared_storage& storage) {
+                    BOOST_ASSERT((a.size() > 2 * n) && (b.size() > n));
+                    limb_type zero = 0;
+                    const CppInt a_parts[3] = {toom_part(a, 0, n, zero), toom_part(a, 1, n, zero),
+                                               toom_part(a, 2, n, zero)};
+                    const CppInt b_parts[2] = {toom_part(b, 0, n, zero), toom_part(b, 1, n, zero)};
+
+                    CppInt a1(storage, n + 2), am1(storage, n + 2), b1(storage, n + 2), bm1(storage, n + 2);
+                    CppInt r1(storage, 2 * n + 4), rm1(storage, 2 * n + 4);
+
+                    unsigned top = 3 * n;
+                    CppInt r0(result.limbs(), 0, top), rinf(result.limbs(), top, result.size() - top);
+                    toom_multiply_ends(result, r0, rinf, a_parts[0], b_parts[0], a_parts[2], b_parts[1], top,
+                                       storage);
+
+                    toom_evaluate(a1, a_parts, 3, 1, false);
+                    toom_evaluate(am1, a_parts, 3, 1, true);
+                    toom_evaluate(b1, b_parts, 2, 1, false);
+                    toom_evaluate(bm1, b_parts, 2, 1, true);
+                    toom_multiply(r1, a1, b1, storage);
+                    toom_multiply(rm1, am1, bm1, storage);
+                    //
+                    // c1 + c3 = (r(1) - r(-1)) / 2 and c0 + c2 = r(1) - (c1 + c3):
+                    //
+                    eval_subtract(rm1, rm1, r1);
+                    rm1.negate();
+                    toom_divide_exact(rm1, 2);
+                    eval_subtract(r1, r1, rm1);
+                    eval_subtract(r1, r1, r0);
+                    eval_subtract(rm1, rm1, rinf);
+
+                    toom_add_coefficient(result, rm1, n);
+                    toom_add_coefficient(result, r1, 2 * n);
+
+                    storage.deallocate(4 * (n + 2) + 2 * (2 * n + 4));
+                    result.normalize();
+                }
+
+                //
+                // Toom-4 for large balanced arguments, the product has degree 6 and is interpolated from the
+                // points 0, 1, -1, 2, -2, 3, infinity by separating the even and odd coefficients:
+                //
+                template<class CppInt>
+                inline void multiply_toom4(CppInt& result, const CppInt& a, const CppInt& b, unsigned n,
+                                           typename CppInt::scoped_shared_storage& storage) {
+                    BOOST_ASSERT((a.size() > 3 * n) && (b.size() > 3 * n));
+                    limb_type zero = 0;
+                    const CppInt a_parts[4] = {toom_part(a, 0, n, zero), toom_part(a, 1, n, zero),
+                                               toom_part(a, 2, n, zero), toom_part(a, 3, n, zero)};
+                    const CppInt b_parts[4] = {toom_part(b, 0, n, zero), toom_part(b, 1, n, zero),
+                                               toom_part(b, 2, n, zero), toom_part(b, 3, n, zero)};
+
+                    CppInt a1(storage, n + 2), am1(storage, n + 2), a2(storage, n + 2), am2(storage, n + 2),
+                        a3(storage, n + 2);
+                    CppInt b1(storage, n + 2), bm1(storage, n + 2), b2(storage, n + 2), bm2(storage, n + 2),
+                        b3(storage, n + 2);
+                    CppInt r1(storage, 2 * n + 5), rm1(storage, 2 * n + 5), r2(storage, 2 * n + 5),
+                        rm2(storage, 2 * n + 5), r3(storage, 2 * n + 5), t(storage, 2 * n + 5);
+
+                    unsigned top = 6 * n;
+                    CppInt r0(result.limbs(), 0, top), rinf(result.limbs(), top, result.size() - top);
+                    toom_multiply_ends(result, r0, rinf, a_parts[0], b_parts[0], a_parts[3], b_parts[3], top,
+                                       storage);
+
+                    toom_evaluate(a1, a_parts, 4, 1, false);
+                    toom_evaluate(am1, a_parts, 4, 1, true);
+                    toom_evaluate(a2, a_parts, 4, 2, false);
+                    toom_evaluate(am2, a_parts, 4, 2, true);
+                    toom_evaluate(a3, a_parts, 4, 3, false);
+                    if (toom_is_square(a, b)) {
+                        toom_multiply(r1, a1, a1, storage);
+                        toom_multiply(rm1, am1, am1, storage);
+                        toom_multiply(r2, a2, a2, storage);
+                        toom_multiply(rm2, am2, am2, storage);
+                        toom_multiply(r3, a3, a3, storage);
+                    } else {
+                        toom_evaluate(b1, b_parts, 4, 1, false);
+                        toom_evaluate(bm1, b_parts, 4, 1, true);
+                        toom_evaluate(b2, b_parts, 4, 2, false);
+                        toom_evaluate(bm2, b_parts, 4, 2, true);
+                        toom_evaluate(b3, b_parts, 4, 3, false);
+                        toom_multiply(r1, a1, b1, storage);
+                        toom_multiply(rm1, am1, bm1, storage);
+                        toom_multiply(r2, a2, b2, storage);
+                        toom_multiply(rm2, am2, bm2, storage);
+                        toom_multiply(r3, a3, b3, storage);
+                    }
+                    //
+                    // O1 = (r(1) - r(-1)) / 2, E1 = r(1) - O1, O2 = (r(2) - r(-2)) / 4, E2 = r(2) - 2 O2:
+                    //
+                    eval_subtract(rm1, rm1, r1);
+                    rm1.negate();
+                    toom_divide_exact(rm1, 2);
+                    eval_subtract(r1, r1, rm1);
+                    eval_subtract(rm2, rm2, r2);
+                    rm2.negate();
+                    toom_divide_exact(rm2, 4);
+                    eval_subtract(r2, r2, rm2);
+                    eval_subtract(r2, r2, rm2);
+                    //
+                    // c2 + c4 = E1 - c0 - c6, 4 c2 + 16 c4 = E2 - c0 - 64 c6, from which c4 and then c2:
+                    //
+                    eval_subtract(r1, r1, r0);
+                    eval_subtract(r1, r1, rinf);
+                    eval_subtract(r2, r2, r0);
+                    eval_multiply(t, rinf, static_cast<limb_type>(64u));
+                    eval_subtract(r2, r2, t);
+                    eval_multiply(t, r1, static_cast<limb_type>(4u));
+                    eval_subtract(r2, r2, t);
+                    toom_divide_exact(r2, 12);
+                    eval_subtract(r1, r1, r2);
+                    //
+                    // O3 = (r(3) - c0 - 9 c2 - 81 c4 - 729 c6) / 3 = c1 + 9 c3 + 81 c5:
+                    //
+                    eval_subtract(r3, r3, r0);
+                    eval_multiply(t, r1, static_cast<limb_type>(9u));
+                    eval_subtract(r3, r3, t);
+                    eval_multiply(t, r2, static_cast<limb_type>(81u));
+                    eval_subtract(r3, r3, t);
+                    eval_multiply(t, rinf, static_cast<limb_type>(729u));
+                    eval_subtract(r3, r3, t);
+                    toom_divide_exact(r3, 3);
+                    //
+                    // c3 + 5 c5 = (O2 - O1) / 3 and c3 + 10 c5 = (O3 - O1) / 8, from which c5, c3 and then c1:
+                    //
+                    eval_subtract(rm2, rm2, rm1);
+                    toom_divide_exact(rm2, 3);
+                    eval_subtract(r3, r3, rm1);
+                    toom_divide_exact(r3, 8);
+                    eval_subtract(r3, r3, rm2);
+                    toom_divide_exact(r3, 5);
+                    eval_multiply(t, r3, static_cast<limb_type>(5u));
+                    eval_subtract(rm2, rm2, t);
+                    eval_subtract(rm1, rm1, rm2);
+                    eval_subtract(rm1, rm1, r3);
+
+                    toom_add_coefficient(result, rm1, n);
+                    toom_add_coefficient(result, r1, 2 * n);
+                    toom_add_coefficient(result, rm2, 3 * n);
+                    toom_add_coefficient(result, r2, 4 * n);
+                    toom_add_coefficient(result, r3, 5 * n);
+
+                    storage.deallocate(10 * (n + 2) + 6 * (2 * n + 5));
+                    result.normalize();
+                }
+
+                //
+                // Beyond 5:2 the longer argument is cut into slices the size of the shorter one, and each
+                // balanced slice product is added in at its offset:
+                //
+                template<class CppInt>
+                inline void multiply_toom_unbalanced(CppInt& result, const CppInt& a, const CppInt& b,
+                                                     typename CppInt::scoped_shared_storage& storage) {
+                    unsigned as = a.size();
+                    unsigned bs = b.size();
+                    std::memset(result.limbs(), 0, result.size() * sizeof(limb_type));
+                    // Like the parts above, alias b so that only magnitudes are multiplied:
+                    const CppInt b_alias(b.limbs(), 0, bs);
+                    CppInt t(storage, 2 * bs);
+                    for (unsigned i = 0; i < as; i += bs) {
+                        CppInt slice(a.limbs(), i, (std::min)(bs, as - i));
+                        slice.normalize();
+                        toom_multiply(t, slice, b_alias, storage);
+                        toom_add_coefficient(result, t, i);
+                    }
+                    storage.deallocate(2 * bs);
+                    result.normalize();
+                }
+
+#ifdef BOOST_MP_HAS_NTT_MULTIPLY
+                template<class CppInt>
+                inline void multiply_ntt(CppInt& result, const CppInt& a, const CppInt& b) {
+                    //
+                    // The coefficients of the convolution of the limbs overlap by two limbs, add them up with a
+                    // three limb carry:
+                    //
+                    typename CppInt::limb_pointer pr = result.limbs();
+                    limb_type carry[3] = {0, 0, 0};
+                    ntt_convolution(a.limbs(), a.size(), b.limbs(), b.size(), [&](std::size_t k, const limb_type* c) {
+                        double_limb_type t = static_cast<double_limb_type>(carry[0]) + c[0];
+                        pr[k] = static_cast<limb_type>(t);
+                        t = (t >> CppInt::limb_bits) + carry[1] + c[1];
+                        carry[0] = static_cast<limb_type>(t);
+                        t = (t >> CppInt::limb_bits) + carry[2] + c[2];
+                        carry[1] = static_cast<limb_type>(t);
+                        carry[2] = static_cast<limb_type>(t >> CppInt::limb_bits);
+                    });
+                    for (unsigned i = a.size() + b.size() - 1; i < result.size(); ++i) {
+                        pr[i] = carry[0];
+                        carry[0] = carry[1];
+                        carry[1] = carry[2];
+                        carry[2] = 0;
+                    }
+                    result.normalize();
+                }
+#endif
+
+                template<class CppInt>
+                inline void multiply_toom_cook(CppInt& result, const CppInt& a, const CppInt& b,
+                                               typename CppInt::scoped_shared_storage& storage) {
+                    //
+                    // Pick the tier from the ratio of the argument sizes, x is the longer argument:
+                    //
+                    const CppInt& x = a.size() < b.size() ? b : a;
+                    const CppInt& y = a.size() < b.size() ? a : b;
+                    unsigned xs = x.size();
+                    unsigned ys = y.size();
+#ifdef BOOST_MP_HAS_NTT_MULTIPLY
+                    if (ys >= ntt_cutoff) {
+                        multiply_ntt(result, x, y);
+                        return;
+                    }
+#endif
+                    if (4 * xs < 5 * ys) {
+                        if (ys >= toom4_cutoff)
+                            multiply_toom4(result, x, y, (xs + 3) / 4, storage);
+                        else
+                            multiply_toom_5_points(result, x, y, 3, 3, (xs + 2) / 3, storage);
+                    } else if (4 * xs < 7 * ys) {
+                        multiply_toom32(result, x, y, (std::max)((xs + 2) / 3, (ys + 1) / 2), storage);
+                    } else if (2 * xs < 5 * ys) {
+                        multiply_toom_5_points(result, x, y, 4, 2, (std::max)((xs + 3) / 4, (ys + 1) / 2),
+                                               storage);
+                    } else {
+                        multiply_toom_unbalanced(result, x, y, storage);
+                    }
+                }
+
                 inline unsigned karatsuba_storage_size(unsigned s) {
                     //
                     // This estimates how much memory we will need based on
@@ -236,7 +707,14 @@ namespace nil {
                     // which over-estimates how much we need.  We could compute an exact
                     // value, but it would be rather time consuming.
                     //
-                    return 5 * s;
+                    unsigned result = 5 * s;
+                    //
+                    // Above toom3_cutoff the Toom-Cook tiers add their temporaries: each level needs less than
+                    // 6s + 72 limbs and recurses on arguments of at most s / 2 + 3 limbs:
+                    //
+                    for (; s >= toom3_cutoff; s = s / 2 + 3)
+                        result += 6 * s + 72;
+                    return result;
                 }
                 //
                 // There are 2 entry point routines for Karatsuba multiplication:
@@ -426,6 +904,13 @@ namespace nil {
                     // Uses simple (O(n^2)) multiplication when the limbs are less
                     // otherwise switches to karatsuba algorithm based on experimental value (~40 limbs)
                     //
+                    // Squares have their own kernel:
+                    //
+                    if ((void*)&a == (void*)&b) {
+                        eval_square(result, a);
+                        return;
+                    }
+                    //
                     // Trivial cases first:
                     //
                     unsigned as = a.size();
@@ -558,6 +1043,137 @@ namespace nil {
                     result.sign(a.sign() != b.sign());
                 }
 
+                //
+                // Squaring: of the limb products a_i * a_j only those with i < j are formed, then doubled and the
+                // squares of the limbs added in, which takes about half the products of eval_multiply.  Above
+                // karatsuba_square_cutoff the recursive routines recognise squares by their shared limbs.
+                //
+                template<unsigned MinBits1, unsigned MaxBits1, cpp_integer_type SignType1, cpp_int_check_type Checked1,
+                         class Allocator1, unsigned MinBits2, unsigned MaxBits2, cpp_integer_type SignType2,
+                         cpp_int_check_type Checked2, class Allocator2>
+                inline BOOST_MP_CXX14_CONSTEXPR typename std::enable_if<
+                    !is_trivial_cpp_int<cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>>::value &&
+                    !is_trivial_cpp_int<cpp_int_backend<MinBits2, MaxBits2, SignType2, Checked2, Allocator2>>::value>::
+                    type
+                    eval_square(
+                        cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& result,
+                        const cpp_int_backend<MinBits2, MaxBits2, SignType2, Checked2, Allocator2>&
+                            a) noexcept((is_non_throwing_cpp_int<cpp_int_backend<MinBits1, MaxBits1, SignType1,
+                                                                                 Checked1, Allocator1>>::value &&
+                                         (karatsuba_square_cutoff * sizeof(limb_type) * CHAR_BIT > MaxBits1) &&
+                                         (karatsuba_square_cutoff * sizeof(limb_type) * CHAR_BIT > MaxBits2))) {
+                    unsigned as = a.size();
+                    typename cpp_int_backend<MinBits2, MaxBits2, SignType2, Checked2, Allocator2>::const_limb_pointer
+                        pa = a.limbs();
+                    if (as == 1) {
+                        result = static_cast<double_limb_type>(*pa) * static_cast<double_limb_type>(*pa);
+                        return;
+                    }
+                    if ((void*)&result == (void*)&a) {
+                        cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1> t(a);
+                        eval_square(result, t);
+                        return;
+                    }
+
+                    result.resize(2 * as, 2 * as - 1);
+#ifndef BOOST_MP_NO_CONSTEXPR_DETECTION
+                    if (!BOOST_MP_IS_CONST_EVALUATED(as) && (as >= karatsuba_square_cutoff))
+#else
+                    if (as >= karatsuba_square_cutoff)
+#endif
+                    {
+                        setup_karatsuba(result, a, a);
+                        result.sign(false);
+                        return;
+                    }
+                    typename cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>::limb_pointer pr =
+                        result.limbs();
+                    const unsigned limb_bits =
+                        cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>::limb_bits;
+                    unsigned rs = result.size();
+
+                    //
+                    // The products above the diagonal, limbs past the end of a truncated result are skipped.  The
+                    // first row is stored rather than added, so only the first and the last limb need clearing:
+                    //
+                    pr[0] = 0;
+                    if (2 * as - 1 < rs)
+                        pr[2 * as - 1] = 0;
+                    double_limb_type carry = 0;
+                    unsigned j = 1, end = (std::min)(as, rs);
+                    for (; j < end; ++j) {
+                        carry += static_cast<double_limb_type>(pa[0]) * static_cast<double_limb_type>(pa[j]);
+                        pr[j] = static_cast<limb_type>(carry);
+                        carry >>= limb_bits;
+                    }
+                    if (j < rs)
+                        pr[j] = static_cast<limb_type>(carry);
+                    for (unsigned i = 1; (i + 1 < as) && (2 * i + 1 < rs); ++i) {
+                        carry = 0;
+                        for (j = i + 1, end = (std::min)(as, rs - i); j < end; ++j) {
+                            carry += static_cast<double_limb_type>(pa[i]) * static_cast<double_limb_type>(pa[j]);
+                            carry += pr[i + j];
+                            pr[i + j] = static_cast<limb_type>(carry);
+                            carry >>= limb_bits;
+                        }
+                        if (i + j < rs)
+                            pr[i + j] = static_cast<limb_type>(carry);
+                    }
+                    //
+                    // Double them and add the squares on the diagonal, two limbs at a time.  The sum above the
+                    // diagonal always fits in 2 * as - 1 limbs, so for checked types only the last limb can
+                    // overflow:
+                    //
+                    carry = 0;
+                    limb_type shifted_out = 0;
+                    unsigned limit = Checked1 == checked ? 2 * as : (std::min)(rs, 2 * as);
+                    for (unsigned k = 0; k < limit; k += 2) {
+                        const double_limb_type square =
+                            static_cast<double_limb_type>(pa[k / 2]) * static_cast<double_limb_type>(pa[k / 2]);
+                        limb_type l = pr[k];
+                        carry += static_cast<limb_type>(square);
+                        carry += static_cast<limb_type>((l << 1) | shifted_out);
+                        shifted_out = l >> (limb_bits - 1);
+                        pr[k] = static_cast<limb_type>(carry);
+                        carry >>= limb_bits;
+
+                        l = k + 1 < rs ? pr[k + 1] : 0;
+                        carry += static_cast<limb_type>(square >> limb_bits);
+                        carry += static_cast<limb_type>((l << 1) | shifted_out);
+                        shifted_out = l >> (limb_bits - 1);
+                        if (k + 1 < rs)
+                            pr[k + 1] = static_cast<limb_type>(carry);
+                        else if (static_cast<limb_type>(carry))
+                            resize_for_carry(result, k + 2);    // Throws, checked types only get here
+                        carry >>= limb_bits;
+                    }
+
+                    result.normalize();
+                    result.sign(false);
+                }
+
+                template<unsigned MinBits1, unsigned MaxBits1, cpp_integer_type SignType1, cpp_int_check_type Checked1,
+                         class Allocator1, unsigned MinBits2, unsigned MaxBits2, cpp_integer_type SignType2,
+                         cpp_int_check_type Checked2, class Allocator2>
+                inline BOOST_MP_CXX14_CONSTEXPR typename std::enable_if<
+                    is_trivial_cpp_int<cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>>::value ||
+                    is_trivial_cpp_int<cpp_int_backend<MinBits2, MaxBits2, SignType2, Checked2, Allocator2>>::value>::
+                    type
+                    eval_square(
+                        cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& result,
+                        const cpp_int_backend<MinBits2, MaxBits2, SignType2, Checked2, Allocator2>&
+                            a) noexcept((noexcept(eval_multiply(std::declval<cpp_int_backend<MinBits1, MaxBits1,
+                                                                                             SignType1, Checked1,
+                                                                                             Allocator1>&>(),
+                                                                std::declval<const cpp_int_backend<MinBits2, MaxBits2,
+                                                                                                   SignType2, Checked2,
+                                                                                                   Allocator2>&>(),
+                                                                std::declval<const cpp_int_backend<MinBits2, MaxBits2,
+                                                                                                   SignType2, Checked2,
+                                                                                                   Allocator2>&>())))) {
+                    eval_multiply(result, a, a);
+                }
+
                 template<unsigned MinBits1, unsigned MaxBits1, cpp_integer_type SignType1, cpp_int_check_type Checked1,
                          class Allocator1, unsigned MinBits2, unsigned MaxBits2, cpp_integer_type SignType2,
                          cpp_int_check_type Checked2, class Allocator2>
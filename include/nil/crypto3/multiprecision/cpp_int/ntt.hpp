@@ -0,0 +1,274 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef BOOST_MULTIPRECISION_CPP_INT_NTT_HPP
+#define BOOST_MULTIPRECISION_CPP_INT_NTT_HPP
+
+#include <nil/crypto3/multiprecision/cpp_int/cpp_int_config.hpp>
+#include <nil/crypto3/multiprecision/detail/number_base.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+//
+// The number theoretic transform works with 64-bit residues and needs their 128-bit products, so it is only
+// available where the limbs are 64 bits wide.
+//
+#if defined(BOOST_HAS_INT128)
+#define BOOST_MP_HAS_NTT_MULTIPLY
+
+namespace nil {
+    namespace crypto3 {
+        namespace multiprecision {
+            namespace backends {
+                //
+                // Multi-prime NTT multiplication: the product of two word arrays is their convolution, which is
+                // computed by number theoretic transforms modulo three primes p = c 2^k + 1 below 2^62 and then
+                // reconstructed by the Chinese remainder theorem. The primes multiply to more than 2^183, so every
+                // coefficient of the convolution of up to 2^55 64-bit words is recovered exactly.
+                //
+                namespace detail {
+                    //
+                    // Arithmetic modulo one of the primes in Montgomery form with R = 2^64. Since 4p < R, the
+                    // butterflies can keep their values lazily reduced in [0, 2p).
+                    //
+                    class ntt_modulus {
+                    public:
+                        ntt_modulus(limb_type p, limb_type generator) : m_p(p), m_generator(generator) {
+                            // p * p == 1 mod 8, each Newton step doubles the number of correct bits:
+                            limb_type inverse = p;
+                            for (unsigned i = 0; i < 5; ++i) {
+                                inverse *= 2 - p * inverse;
+                            }
+                            m_p_negated_inverse = 0 - inverse;
+                            limb_type r = (0 - p) % p;
+                            m_r2 = static_cast<limb_type>(static_cast<double_limb_type>(r) * r % p);
+                        }
+
+                        limb_type p() const {
+                            return m_p;
+                        }
+
+                        // a b / R, in [0, 2p) for a b < p R:
+                        limb_type multiply(limb_type a, limb_type b) const {
+                            double_limb_type t = static_cast<double_limb_type>(a) * b;
+                            limb_type m = static_cast<limb_type>(t) * m_p_negated_inverse;
+                            return static_cast<limb_type>((t + static_cast<double_limb_type>(m) * m_p) >>
+                                                          (sizeof(limb_type) * CHAR_BIT));
+                        }
+
+                        limb_type normalize(limb_type a) const {
+                            return a >= m_p ? a - m_p : a;
+                        }
+
+                        limb_type to_montgomery(limb_type a) const {
+                            return normalize(multiply(a % m_p, m_r2));
+                        }
+
+                        // The Montgomery form of x^e for x in Montgomery form:
+                        limb_type power(limb_type x, limb_type e) const {
+                            limb_type result = to_montgomery(1);
+                            for (; e; e >>= 1) {
+                                if (e & 1u) {
+                                    result = normalize(multiply(result, x));
+                                }
+                                x = normalize(multiply(x, x));
+                            }
+                            return result;
+                        }
+
+                        // The Montgomery form of a primitive root of unity of order n (a power of 2), or its inverse:
+                        limb_type root_of_unity(std::size_t n, bool inverse) const {
+                            limb_type w = power(to_montgomery(m_generator), (m_p - 1) / n);
+                            return inverse ? power(w, n - 1) : w;
+                        }
+
+                    private:
+                        limb_type m_p;
+                        limb_type m_generator;
+                        limb_type m_p_negated_inverse;
+                        limb_type m_r2;
+                    };
+
+                    constexpr const unsigned ntt_prime_count = 3;
+
+                    inline const ntt_modulus& ntt_prime(unsigned i) {
+                        static const ntt_modulus primes[ntt_prime_count] = {
+                            ntt_modulus(4179340454199820289uLL, 3),    // 29 * 2^57 + 1
+                            ntt_modulus(2485986994308513793uLL, 5),    // 69 * 2^55 + 1
+                            ntt_modulus(1945555039024054273uLL, 5)     // 27 * 2^56 + 1
+                        };
+                        return primes[i];
+                    }
+
+                    //
+                    // The twiddle factors of the stage with butterflies of half-length m are the powers w^j, j < m,
+                    // of a root of unity w of order 2m, they are kept at [m, 2m). A table for transforms of size n
+                    // is therefore also good for all shorter ones and is only ever extended. One table per prime and
+                    // direction is cached per thread.
+                    //
+                    inline const limb_type* ntt_twiddles(unsigned prime, std::size_t n, bool inverse) {
+                        static BOOST_MP_THREAD_LOCAL std::vector<limb_type> tables[ntt_prime_count][2];
+                        std::vector<limb_type>& table = tables[prime][inverse];
+                        if (table.size() < n) {
+                            const ntt_modulus& mod = ntt_prime(prime);
+                            std::size_t m = table.empty() ? 1 : table.size();
+                            table.resize(n);
+                            for (; m < n; m *= 2) {
+                                limb_type w = mod.root_of_unity(2 * m, inverse);
+                                limb_type x = mod.to_montgomery(1);
+                                for (std::size_t j = 0; j < m; ++j) {
+                                    table[m + j] = x;
+                                    x = mod.normalize(mod.multiply(x, w));
+                                }
+                            }
+                        }
+                        return table.data();
+                    }
+
+                    //
+                    // Decimation in frequency: natural order in, bit-reversed order out, values in [0, 2p):
+                    //
+                    inline void ntt_forward(limb_type* a, std::size_t n, const ntt_modulus& mod,
+                                            const limb_type* twiddles) {
+                        const limb_type p2 = 2 * mod.p();
+                        for (std::size_t half = n / 2; half; half /= 2) {
+                            const limb_type* w = twiddles + half;
+                            for (limb_type* block = a; block != a + n; block += 2 * half) {
+                                for (std::size_t j = 0; j < half; ++j) {
+                                    limb_type u = block[j];
+                                    limb_type v = block[j + half];
+                                    limb_type x = u + v;
+                                    block[j] = x >= p2 ? x - p2 : x;
+                                    block[j + half] = mod.multiply(u - v + p2, w[j]);
+                                }
+                            }
+                        }
+                    }
+
+                    //
+                    // Decimation in time with the inverse roots: bit-reversed order in, natural order out, the
+                    // result is n times the inverse transform:
+                    //
+                    inline void ntt_inverse(limb_type* a, std::size_t n, const ntt_modulus& mod,
+                                            const limb_type* twiddles) {
+                        const limb_type p2 = 2 * mod.p();
+                        for (std::size_t half = 1; half < n; half *= 2) {
+                            const limb_type* w = twiddles + half;
+                            for (limb_type* block = a; block != a + n; block += 2 * half) {
+                                for (std::size_t j = 0; j < half; ++j) {
+                                    limb_type u = block[j];
+                                    limb_type v = mod.multiply(block[j + half], w[j]);
+                                    limb_type x = u + v;
+                                    limb_type y = u - v + p2;
+                                    block[j] = x >= p2 ? x - p2 : x;
+                                    block[j + half] = y >= p2 ? y - p2 : y;
+                                }
+                            }
+                        }
+                    }
+
+                    template<typename Word>
+                    inline void ntt_load(limb_type* f, std::size_t n, const Word* a, std::size_t as,
+                                         const ntt_modulus& mod) {
+                        for (std::size_t i = 0; i < as; ++i) {
+                            f[i] = static_cast<limb_type>(a[i]) % mod.p();
+                        }
+                        std::fill(f + as, f + n, static_cast<limb_type>(0u));
+                    }
+                }    // namespace detail
+
+                //
+                // Calls sink(k, c) for k = 0, ..., as + bs - 2 in turn, where c points to the three limbs (least
+                // significant first) of the k-th coefficient sum(a[i] b[k - i]) of the convolution of a and b.
+                // Squaring (a == b and as == bs) saves a third of the transforms.
+                //
+                template<typename Word, typename Sink>
+                void ntt_convolution(const Word* a, std::size_t as, const Word* b, std::size_t bs, Sink sink) {
+                    using detail::ntt_modulus;
+                    using detail::ntt_prime_count;
+
+                    const std::size_t size = as + bs - 1;
+                    std::size_t n = 1;
+                    while (n < size) {
+                        n *= 2;
+                    }
+                    const bool square = (a == b) && (as == bs);
+
+                    std::vector<limb_type> residues(ntt_prime_count * n), f(square ? 0 : n);
+                    for (unsigned i = 0; i < ntt_prime_count; ++i) {
+                        const ntt_modulus& mod = detail::ntt_prime(i);
+                        const limb_type* twiddles = detail::ntt_twiddles(i, n, false);
+                        limb_type* r = residues.data() + i * n;
+                        detail::ntt_load(r, n, a, as, mod);
+                        detail::ntt_forward(r, n, mod, twiddles);
+                        if (square) {
+                            for (std::size_t j = 0; j < n; ++j) {
+                                r[j] = mod.multiply(r[j], r[j]);
+                            }
+                        } else {
+                            detail::ntt_load(f.data(), n, b, bs, mod);
+                            detail::ntt_forward(f.data(), n, mod, twiddles);
+                            for (std::size_t j = 0; j < n; ++j) {
+                                r[j] = mod.multiply(r[j], f[j]);
+                            }
+                        }
+                        detail::ntt_inverse(r, n, mod, detail::ntt_twiddles(i, n, true));
+                    }
+                    //
+                    // The pointwise products left a factor 1 / R and the inverse transform a factor n, both are
+                    // removed by one Montgomery multiplication by R^2 / n. Garner's algorithm then combines the
+                    // residues r0, r1, r2 into r0 + p0 (t1 + p1 t2).
+                    //
+                    const ntt_modulus& m0 = detail::ntt_prime(0);
+                    const ntt_modulus& m1 = detail::ntt_prime(1);
+                    const ntt_modulus& m2 = detail::ntt_prime(2);
+                    const unsigned limb_bits = sizeof(limb_type) * CHAR_BIT;
+                    limb_type scale[ntt_prime_count];
+                    for (unsigned i = 0; i < ntt_prime_count; ++i) {
+                        const ntt_modulus& mod = detail::ntt_prime(i);
+                        scale[i] = mod.to_montgomery(mod.to_montgomery(mod.p() - (mod.p() - 1) / n));
+                    }
+                    // Multiplying by the Montgomery form of x multiplies by x, the constants are kept in that form:
+                    const limb_type p0_inverse_1 = m1.power(m1.to_montgomery(m0.p()), m1.p() - 2);
+                    const limb_type p0_2 = m2.to_montgomery(m0.p());
+                    const limb_type p0p1_inverse_2 = m2.power(m2.normalize(m2.multiply(p0_2, m2.to_montgomery(m1.p()))),
+                                                              m2.p() - 2);
+                    const double_limb_type p0p1 = static_cast<double_limb_type>(m0.p()) * m1.p();
+                    const limb_type p0p1_low = static_cast<limb_type>(p0p1);
+                    const limb_type p0p1_high = static_cast<limb_type>(p0p1 >> limb_bits);
+
+                    limb_type c[3];
+                    for (std::size_t k = 0; k < size; ++k) {
+                        limb_type r0 = m0.normalize(m0.multiply(residues[k], scale[0]));
+                        limb_type r1 = m1.normalize(m1.multiply(residues[n + k], scale[1]));
+                        limb_type r2 = m2.normalize(m2.multiply(residues[2 * n + k], scale[2]));
+                        // t1 = (r1 - r0) / p0 mod p1 and t2 = (r2 - r0 - p0 t1) / (p0 p1) mod p2:
+                        limb_type t1 = m1.normalize(m1.multiply(r1 + m1.p() - r0 % m1.p(), p0_inverse_1));
+                        limb_type s = m2.normalize(m2.normalize(m2.multiply(t1, p0_2)) + r0 % m2.p());
+                        limb_type t2 = m2.normalize(m2.multiply(r2 + m2.p() - s, p0p1_inverse_2));
+                        // r0 + p0 t1 + p0 p1 t2 < 2^192:
+                        double_limb_type low = static_cast<double_limb_type>(m0.p()) * t1 + r0;
+                        double_limb_type t = static_cast<double_limb_type>(p0p1_low) * t2 + static_cast<limb_type>(low);
+                        c[0] = static_cast<limb_type>(t);
+                        t = (t >> limb_bits) + static_cast<double_limb_type>(p0p1_high) * t2 +
+                            static_cast<limb_type>(low >> limb_bits);
+                        c[1] = static_cast<limb_type>(t);
+                        c[2] = static_cast<limb_type>(t >> limb_bits);
+                        sink(k, static_cast<const limb_type*>(c));
+                    }
+                }
+            }    // namespace backends
+        }        // namespace multiprecision
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // BOOST_HAS_INT128
+
+#endif    // BOOST_MULTIPRECISION_CPP_INT_NTT_HPP
@@ -0,0 +1,442 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+//
+// Modular exponentiation for cpp_int_backend: an odd modulus is handled in Montgomery form
+//
+#ifndef BOOST_MP_CPP_INT_POWM_HPP
+#define BOOST_MP_CPP_INT_POWM_HPP
+
+#include <nil/crypto3/multiprecision/detail/sliding_window.hpp>
+#include <nil/crypto3/multiprecision/modular/montgomery_mul_fixed.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace nil {
+    namespace crypto3 {
+        namespace multiprecision {
+            namespace backends {
+                namespace detail {
+
+                    //
+                    // Montgomery arithmetic modulo a modulus of any count of limbs known at runtime only,
+                    // the moduli of the dedicated kernels sizes are passed to montgomery_mul_kernel
+                    //
+                    class montgomery_powm_context {
+                    public:
+                        template<typename Backend>
+                        explicit montgomery_powm_context(const Backend& m) :
+                            m_limbs_count(m.size()), m_mod(m.limbs(), m.limbs() + m.size()),
+                            m_p_dash(find_p_dash(m.limbs()[0])), m_scratch(2 * m.size() + 2) {
+                            using default_ops::eval_bit_set;
+
+                            /// R^2 mod m, R = 2^(limbs_count * limb_bits)
+                            cpp_int_backend<> r, r2, mod;
+                            mod = m;
+                            eval_bit_set(r, static_cast<unsigned>(2 * m_limbs_count * limb_bits));
+                            eval_modulus(r2, r, mod);
+                            m_r2 = to_limbs(r2);
+
+                            /// R mod m is the Montgomery form of one
+                            m_one.assign(m_limbs_count, 0);
+                            m_one[0] = 1u;
+                            mul(m_one.data(), m_one.data(), m_r2.data());
+                        }
+
+                        std::size_t limbs_count() const {
+                            return m_limbs_count;
+                        }
+
+                        //
+                        // limbs of x zero padded to the modulus size, x should be lesser than the modulus
+                        //
+                        template<typename Backend>
+                        std::vector<limb_type> to_limbs(const Backend& x) const {
+                            std::vector<limb_type> result(m_limbs_count, 0);
+                            std::copy(x.limbs(), x.limbs() + std::min<std::size_t>(x.size(), m_limbs_count),
+                                      result.begin());
+                            return result;
+                        }
+
+                        const std::vector<limb_type>& r2() const {
+                            return m_r2;
+                        }
+
+                        const std::vector<limb_type>& one() const {
+                            return m_one;
+                        }
+
+                        void to_montgomery(limb_type* result, const limb_type* x) {
+                            mul(result, x, m_r2.data());
+                        }
+
+                        void from_montgomery(limb_type* result, const limb_type* x) {
+                            std::vector<limb_type> unit(m_limbs_count, 0);
+                            unit[0] = 1u;
+                            mul(result, x, unit.data());
+                        }
+
+                        //
+                        // result = x * y * R^-1 mod m, result may alias x or y
+                        //
+                        void mul(limb_type* result, const limb_type* x, const limb_type* y) {
+#if defined(BOOST_HAS_INT128)
+                            switch (m_limbs_count) {
+                                case 4:
+                                    return montgomery_mul_kernel<4>(result, x, y, m_mod.data(), m_p_dash);
+                                case 6:
+                                    return montgomery_mul_kernel<6>(result, x, y, m_mod.data(), m_p_dash);
+                                case 8:
+                                    return montgomery_mul_kernel<8>(result, x, y, m_mod.data(), m_p_dash);
+                                case 12:
+                                    return montgomery_mul_kernel<12>(result, x, y, m_mod.data(), m_p_dash);
+                                default:
+                                    break;
+                            }
+#endif
+                            const std::size_t n = m_limbs_count;
+                            limb_type* t = m_scratch.data();
+                            std::fill(t, t + n + 2, limb_type(0));
+
+                            for (std::size_t i = 0; i < n; ++i) {
+                                mul_add_row(t, x, y[i]);
+                                mul_add_row(t, m_mod.data(), t[0] * m_p_dash);
+
+                                /// t[0] is zero now, shift accumulator one limb to the right
+                                std::copy(t + 1, t + n + 2, t);
+                                t[n + 1] = 0;
+                            }
+                            reduce_once(result, t, t[n]);
+                        }
+
+                        //
+                        // result = x^2 * R^-1 mod m, every cross product x[i] * x[j] (i < j) is computed once and
+                        // doubled before the reduction
+                        //
+                        void sqr(limb_type* result, const limb_type* x) {
+#if defined(BOOST_HAS_INT128)
+                            switch (m_limbs_count) {
+                                case 4:
+                                    return montgomery_sqr_kernel<4>(result, x, m_mod.data(), m_p_dash);
+                                case 6:
+                                    return montgomery_sqr_kernel<6>(result, x, m_mod.data(), m_p_dash);
+                                case 8:
+                                    return montgomery_sqr_kernel<8>(result, x, m_mod.data(), m_p_dash);
+                                case 12:
+                                    return montgomery_sqr_kernel<12>(result, x, m_mod.data(), m_p_dash);
+                                default:
+                                    break;
+                            }
+#endif
+                            const std::size_t n = m_limbs_count;
+                            limb_type* t = m_scratch.data();
+                            std::fill(t, t + 2 * n + 1, limb_type(0));
+                            double_limb_type carry;
+
+                            for (std::size_t i = 0; i + 1 < n; ++i) {
+                                carry = 0;
+                                for (std::size_t j = i + 1; j < n; ++j) {
+                                    carry += static_cast<double_limb_type>(x[i]) * x[j] + t[i + j];
+                                    t[i + j] = static_cast<limb_type>(carry);
+                                    carry >>= limb_bits;
+                                }
+                                t[i + n] = static_cast<limb_type>(carry);
+                            }
+
+                            limb_type high_bit = 0;
+                            for (std::size_t i = 0; i < 2 * n; ++i) {
+                                limb_type next_high_bit = t[i] >> (limb_bits - 1);
+                                t[i] = (t[i] << 1u) | high_bit;
+                                high_bit = next_high_bit;
+                            }
+
+                            carry = 0;
+                            for (std::size_t i = 0; i < n; ++i) {
+                                carry += static_cast<double_limb_type>(x[i]) * x[i] + t[2 * i];
+                                t[2 * i] = static_cast<limb_type>(carry);
+                                carry >>= limb_bits;
+                                carry += t[2 * i + 1];
+                                t[2 * i + 1] = static_cast<limb_type>(carry);
+                                carry >>= limb_bits;
+                            }
+
+                            limb_type top_carry = 0;
+                            for (std::size_t i = 0; i < n; ++i) {
+                                limb_type u = t[i] * m_p_dash;
+                                carry = 0;
+                                for (std::size_t j = 0; j < n; ++j) {
+                                    carry += static_cast<double_limb_type>(m_mod[j]) * u + t[i + j];
+                                    t[i + j] = static_cast<limb_type>(carry);
+                                    carry >>= limb_bits;
+                                }
+                                carry += static_cast<double_limb_type>(t[i + n]) + top_carry;
+                                t[i + n] = static_cast<limb_type>(carry);
+                                top_carry = static_cast<limb_type>(carry >> limb_bits);
+                            }
+                            reduce_once(result, t + n, top_carry);
+                        }
+
+                        //
+                        // result = x + y mod m, result may alias x or y
+                        //
+                        void add(limb_type* result, const limb_type* x, const limb_type* y) {
+                            const std::size_t n = m_limbs_count;
+                            limb_type* t = m_scratch.data();
+                            double_limb_type carry = 0;
+                            for (std::size_t j = 0; j < n; ++j) {
+                                carry += static_cast<double_limb_type>(x[j]) + y[j];
+                                t[j] = static_cast<limb_type>(carry);
+                                carry >>= limb_bits;
+                            }
+                            reduce_once(result, t, static_cast<limb_type>(carry));
+                        }
+
+                        //
+                        // result = x - y mod m, result may alias x or y
+                        //
+                        void sub(limb_type* result, const limb_type* x, const limb_type* y) {
+                            const std::size_t n = m_limbs_count;
+                            limb_type borrow = 0;
+                            for (std::size_t j = 0; j < n; ++j) {
+                                limb_type difference = x[j] - y[j];
+                                limb_type next_borrow = x[j] < y[j] || difference < borrow;
+                                result[j] = difference - borrow;
+                                borrow = next_borrow;
+                            }
+                            if (borrow) {
+                                double_limb_type carry = 0;
+                                for (std::size_t j = 0; j < n; ++j) {
+                                    carry += static_cast<double_limb_type>(result[j]) + m_mod[j];
+                                    result[j] = static_cast<limb_type>(carry);
+                                    carry >>= limb_bits;
+                                }
+                            }
+                        }
+
+                        //
+                        // result = x / 2 mod m: an odd x is made even by adding the odd modulus, the division is
+                        // exact in Montgomery form as well, result may alias x
+                        //
+                        void half(limb_type* result, const limb_type* x) {
+                            const std::size_t n = m_limbs_count;
+                            limb_type* t = m_scratch.data();
+                            std::copy(x, x + n, t);
+                            limb_type high = 0;
+                            if (t[0] & 1u) {
+                                double_limb_type carry = 0;
+                                for (std::size_t j = 0; j < n; ++j) {
+                                    carry += static_cast<double_limb_type>(t[j]) + m_mod[j];
+                                    t[j] = static_cast<limb_type>(carry);
+                                    carry >>= limb_bits;
+                                }
+                                high = static_cast<limb_type>(carry);
+                            }
+                            for (std::size_t j = 0; j + 1 < n; ++j) {
+                                result[j] = (t[j] >> 1u) | (t[j + 1] << (limb_bits - 1));
+                            }
+                            result[n - 1] = (t[n - 1] >> 1u) | (high << (limb_bits - 1));
+                        }
+
+                        //
+                        // result = base^p in Montgomery form by left-to-right sliding window exponentiation,
+                        // base is in Montgomery form, result may alias base
+                        //
+                        template<typename Backend>
+                        void exp(limb_type* result, const limb_type* base, const Backend& p) {
+                            using default_ops::eval_is_zero;
+                            using default_ops::eval_msb;
+
+                            const std::size_t n = m_limbs_count;
+                            if (eval_is_zero(p)) {
+                                std::copy(m_one.begin(), m_one.end(), result);
+                                return;
+                            }
+
+                            const std::size_t window_bits = nil::crypto3::multiprecision::detail::sliding_window_bits(
+                                static_cast<std::size_t>(eval_msb(p)) + 1u);
+
+                            /// table[k] = base^(2k + 1), k < 2^(window_bits - 1)
+                            std::vector<limb_type> table(n << (window_bits - 1u));
+                            std::copy(base, base + n, table.begin());
+                            if (window_bits > 1u) {
+                                std::vector<limb_type> base_sqr(n);
+                                sqr(base_sqr.data(), base);
+                                for (std::size_t k = 1; k < (std::size_t(1u) << (window_bits - 1u)); ++k) {
+                                    mul(&table[k * n], &table[(k - 1) * n], base_sqr.data());
+                                }
+                            }
+
+                            std::vector<limb_type> acc(m_one);
+                            exp_operations operations {*this, table.data(), acc.data()};
+                            nil::crypto3::multiprecision::detail::sliding_window_exp(p, window_bits, operations);
+                            std::copy(acc.begin(), acc.end(), result);
+                        }
+
+                    protected:
+                        constexpr static std::size_t limb_bits = std::numeric_limits<limb_type>::digits;
+
+                        //
+                        // accumulator operations of sliding_window_exp on n-limb Montgomery residues
+                        //
+                        struct exp_operations {
+                            void assign(std::size_t k) {
+                                std::copy(table + k * context.m_limbs_count, table + (k + 1) * context.m_limbs_count,
+                                          acc);
+                            }
+
+                            void square() {
+                                context.sqr(acc, acc);
+                            }
+
+                            void multiply(std::size_t k) {
+                                context.mul(acc, acc, table + k * context.m_limbs_count);
+                            }
+
+                            montgomery_powm_context& context;
+                            const limb_type* table;
+                            limb_type* acc;
+                        };
+
+                        /// -m^-1 mod 2^limb_bits by Newton iteration, every step doubles the count of correct bits
+                        static limb_type find_p_dash(limb_type m0) {
+                            limb_type inverse = m0;
+                            for (std::size_t bits = 3; bits < limb_bits; bits *= 2) {
+                                inverse *= 2u - m0 * inverse;
+                            }
+                            return ~inverse + 1u;
+                        }
+
+                        //
+                        // t[0..n+1] += a[0..n-1] * b
+                        //
+                        void mul_add_row(limb_type* t, const limb_type* a, limb_type b) const {
+                            const std::size_t n = m_limbs_count;
+                            double_limb_type carry = 0;
+                            for (std::size_t j = 0; j < n; ++j) {
+                                carry += static_cast<double_limb_type>(a[j]) * b + t[j];
+                                t[j] = static_cast<limb_type>(carry);
+                                carry >>= limb_bits;
+                            }
+                            carry += t[n];
+                            t[n] = static_cast<limb_type>(carry);
+                            t[n + 1] += static_cast<limb_type>(carry >> limb_bits);
+                        }
+
+                        //
+                        // result = t - m if t + high * R >= m, t otherwise, t + high * R should be lesser than 2m
+                        //
+                        void reduce_once(limb_type* result, const limb_type* t, limb_type high) const {
+                            const std::size_t n = m_limbs_count;
+                            limb_type borrow = 0;
+                            for (std::size_t j = 0; j < n; ++j) {
+                                limb_type difference = t[j] - m_mod[j];
+                                limb_type next_borrow = t[j] < m_mod[j] || difference < borrow;
+                                result[j] = difference - borrow;
+                                borrow = next_borrow;
+                            }
+                            if (!high && borrow) {
+                                std::copy(t, t + n, result);
+                            }
+                        }
+
+                        std::size_t m_limbs_count;
+                        std::vector<limb_type> m_mod;
+                        limb_type m_p_dash;
+                        std::vector<limb_type> m_r2;
+                        std::vector<limb_type> m_one;
+                        std::vector<limb_type> m_scratch;
+                    };
+
+                    //
+                    // result = a^p mod c for odd c > 1, nonnegative a and positive p in Montgomery form
+                    //
+                    template<class Backend>
+                    void eval_powm_montgomery(Backend& result, const Backend& a, const Backend& p, const Backend& c) {
+                        using default_ops::eval_lt;
+
+                        montgomery_powm_context context(c);
+                        const std::size_t n = context.limbs_count();
+
+                        std::vector<limb_type> acc;
+                        if (eval_lt(a, c)) {
+                            acc = context.to_limbs(a);
+                        } else {
+                            Backend reduced;
+                            eval_modulus(reduced, a, c);
+                            acc = context.to_limbs(reduced);
+                        }
+                        context.to_montgomery(acc.data(), acc.data());
+                        context.exp(acc.data(), acc.data(), p);
+                        context.from_montgomery(acc.data(), acc.data());
+
+                        result.resize(static_cast<unsigned>(n), static_cast<unsigned>(n));
+                        std::copy(acc.begin(), acc.end(), result.limbs());
+                        result.sign(false);
+                        result.normalize();
+                    }
+                }    // namespace detail
+
+                //
+                // a^p mod c: an odd modulus is passed through a temporary Montgomery context instead of a long
+                // division after every multiplication, the rest is left to the generic algorithm
+                //
+                template<unsigned MinBits, unsigned MaxBits, cpp_integer_type SignType, cpp_int_check_type Checked,
+                         class Allocator>
+                BOOST_MP_CXX14_CONSTEXPR typename std::enable_if<
+                    !is_trivial_cpp_int<cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>>::value>::type
+                    eval_powm(cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>& result,
+                              const cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>& a,
+                              const cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>& p,
+                              const cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>& c) {
+                    using default_ops::eval_get_sign;
+                    using default_ops::eval_is_zero;
+
+                    const bool is_montgomery_applicable = eval_get_sign(a) >= 0 && eval_get_sign(p) > 0 &&
+                                                          eval_get_sign(c) > 0 && (c.limbs()[0] & 1u) &&
+                                                          (c.size() > 1 || c.limbs()[0] > 1u);
+#ifndef BOOST_MP_NO_CONSTEXPR_DETECTION
+                    if (is_montgomery_applicable && !BOOST_MP_IS_CONST_EVALUATED(c.size())) {
+                        detail::eval_powm_montgomery(result, a, p, c);
+                        return;
+                    }
+#endif
+                    default_ops::eval_powm(result, a, p, c);
+                }
+
+                //
+                // a^p mod c for a built-in exponent, such as a small RSA public exponent: the exponent is converted
+                // to a backend to take the Montgomery path above
+                //
+                template<unsigned MinBits, unsigned MaxBits, cpp_integer_type SignType, cpp_int_check_type Checked,
+                         class Allocator, class Integer>
+                BOOST_MP_CXX14_CONSTEXPR typename std::enable_if<
+                    !is_trivial_cpp_int<cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>>::value &&
+                    nil::crypto3::multiprecision::detail::is_integral<Integer>::value>::type
+                    eval_powm(cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>& result,
+                              const cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>& a, Integer p,
+                              const cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>& c) {
+                    if (p < 0) {
+                        BOOST_THROW_EXCEPTION(std::runtime_error("powm requires a positive exponent."));
+                    }
+                    typedef cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator> backend_type;
+                    typedef typename nil::crypto3::multiprecision::detail::canonical<
+                        typename nil::crypto3::multiprecision::detail::make_unsigned<Integer>::type,
+                        backend_type>::type ui_type;
+
+                    backend_type exp;
+                    exp = static_cast<ui_type>(p);
+                    eval_powm(result, a, exp, c);
+                }
+            }    // namespace backends
+        }        // namespace multiprecision
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // BOOST_MP_CPP_INT_POWM_HPP
@@ -153,6 +153,13 @@ namespace nil {
                     eval_multiply_subtract(T& t, const U& u, const V& v) {
                     eval_multiply_subtract(t, v, u);
                 }
+                //
+                // Squaring, backends with a dedicated squaring kernel overload this:
+                //
+                template<class T, class U>
+                inline BOOST_MP_CXX14_CONSTEXPR void eval_square(T& result, const U& u) {
+                    eval_multiply(result, u, u);
+                }
                 template<class T, class V>
                 inline BOOST_MP_CXX14_CONSTEXPR
                     typename std::enable_if<std::is_convertible<V, number<T, et_on>>::value &&
@@ -2917,6 +2924,22 @@ namespace nil {
                 return s;
             }
             //
+            // Square, uses the squaring kernel of the backend when it has one:
+            //
+            template<class B, expression_template_option ExpressionTemplates>
+            inline BOOST_MP_CXX14_CONSTEXPR number<B, ExpressionTemplates>
+                square(const number<B, ExpressionTemplates>& x) {
+                using default_ops::eval_square;
+                number<B, ExpressionTemplates> result;
+                eval_square(result.backend(), x.backend());
+                return result;
+            }
+            template<class tag, class A1, class A2, class A3, class A4>
+            inline BOOST_MP_CXX14_CONSTEXPR typename detail::expression<tag, A1, A2, A3, A4>::result_type
+                square(const detail::expression<tag, A1, A2, A3, A4>& x) {
+                return square(typename detail::expression<tag, A1, A2, A3, A4>::result_type(x));
+            }
+            //
             // fma:
             //
 
@@ -0,0 +1,86 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+//
+// Left-to-right sliding window exponentiation shared by the modular backends and cpp_int powm
+//
+#ifndef BOOST_MP_DETAIL_SLIDING_WINDOW_HPP
+#define BOOST_MP_DETAIL_SLIDING_WINDOW_HPP
+
+#include <nil/crypto3/multiprecision/number.hpp>
+
+#include <cstddef>
+
+namespace nil {
+    namespace crypto3 {
+        namespace multiprecision {
+            namespace detail {
+
+                /// the widest window, a table of odd powers holds at most 2^(max_sliding_window_bits - 1) entries
+                constexpr std::size_t max_sliding_window_bits = 6u;
+
+                //
+                // window size of sliding window exponentiation depending on the exponent length, each threshold is
+                // the length from which the wider window saves more multiplications than its table costs
+                //
+                constexpr std::size_t sliding_window_bits(std::size_t exp_bits) {
+                    return exp_bits > 671u ? 6u
+                                           : exp_bits > 239u ? 5u : exp_bits > 79u ? 4u : exp_bits > 23u ? 3u : 1u;
+                }
+
+                //
+                // Scans the positive exponent exp from its most significant bit by windows of at most window_bits
+                // bits starting and ending with a set bit. The accumulator of ops starts as one: the first window
+                // sets it by ops.assign(k) to the k-th odd power base^(2k + 1), after which every bit squares it
+                // by ops.square() and every window multiplies it by ops.multiply(k).
+                //
+                template<typename Exponent, typename Operations>
+                constexpr void sliding_window_exp(const Exponent& exp, std::size_t window_bits, Operations& ops) {
+                    using default_ops::eval_bit_test;
+                    using default_ops::eval_msb;
+
+                    bool acc_is_one = true;
+                    std::size_t i = static_cast<std::size_t>(eval_msb(exp)) + 1u;
+                    while (i > 0) {
+                        if (!eval_bit_test(exp, static_cast<unsigned>(i - 1u))) {
+                            if (!acc_is_one) {
+                                ops.square();
+                            }
+                            --i;
+                            continue;
+                        }
+
+                        /// window [l, i) starts and ends with set bits
+                        std::size_t l = i > window_bits ? i - window_bits : 0u;
+                        while (!eval_bit_test(exp, static_cast<unsigned>(l))) {
+                            ++l;
+                        }
+
+                        std::size_t window_value = 0;
+                        for (std::size_t j = i; j > l; --j) {
+                            window_value = (window_value << 1u) |
+                                           (eval_bit_test(exp, static_cast<unsigned>(j - 1u)) ? 1u : 0u);
+                            if (!acc_is_one) {
+                                ops.square();
+                            }
+                        }
+
+                        if (acc_is_one) {
+                            ops.assign(window_value >> 1u);
+                            acc_is_one = false;
+                        } else {
+                            ops.multiply(window_value >> 1u);
+                        }
+                        i = l;
+                    }
+                }
+            }    // namespace detail
+        }        // namespace multiprecision
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // BOOST_MP_DETAIL_SLIDING_WINDOW_HPP
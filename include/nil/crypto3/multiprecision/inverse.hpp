@@ -13,6 +13,9 @@
 
 #include <boost/type_traits/is_integral.hpp>
 
+#include <iterator>
+#include <vector>
+
 #include <nil/crypto3/multiprecision/cpp_int.hpp>
 #include <nil/crypto3/multiprecision/cpp_int/cpp_int_config.hpp>
 #include <nil/crypto3/multiprecision/modular/modular_adaptor.hpp>
@@ -64,14 +67,91 @@ namespace nil {
                 return res;
             }
 
-            template<typename Backend, expression_template_option ExpressionTemplates>
-            constexpr number<modular_adaptor<Backend>, ExpressionTemplates>
-            inverse_mod(const number<modular_adaptor<Backend>, ExpressionTemplates>& modular) {
-                number<modular_adaptor<Backend>, ExpressionTemplates> res;
+            template<typename Backend, typename ModularParamsHolder, expression_template_option ExpressionTemplates>
+            constexpr number<modular_adaptor<Backend, ModularParamsHolder>, ExpressionTemplates>
+            inverse_mod(const number<modular_adaptor<Backend, ModularParamsHolder>, ExpressionTemplates>& modular) {
+                number<modular_adaptor<Backend, ModularParamsHolder>, ExpressionTemplates> res;
                 backends::eval_inverse_mod(res.backend(), modular.backend());
                 return res;
             }
 
+            namespace detail {
+                //
+                // First half of Montgomery's trick: prefix_products[i] is the product of the first i + 1 nonzero
+                // elements of [first, last) and inverted_product the inverse of their whole product. Returns false
+                // if that product is not invertible, that is if some nonzero element is not.
+                //
+                template<typename BidirectionalIterator, typename Modular>
+                bool batch_inverse_products(BidirectionalIterator first, BidirectionalIterator last,
+                                            std::vector<Modular>& prefix_products, Modular& inverted_product) {
+                    prefix_products.clear();
+                    for (BidirectionalIterator it = first; it != last; ++it) {
+                        if (it->is_zero()) {
+                            continue;
+                        }
+                        if (prefix_products.empty()) {
+                            prefix_products.push_back(*it);
+                        } else {
+                            prefix_products.push_back(prefix_products.back() * *it);
+                        }
+                    }
+                    if (prefix_products.empty()) {
+                        return true;
+                    }
+
+                    /// the inverse of a nonzero residue is nonzero, zero is returned when there is none
+                    inverted_product = inverse_mod(prefix_products.back());
+                    return !inverted_product.is_zero();
+                }
+
+                //
+                // Second half of Montgomery's trick: the nonzero elements of [first, last) are replaced by their
+                // inverses, from the last one down
+                //
+                template<typename BidirectionalIterator, typename Modular>
+                void batch_inverse_write(BidirectionalIterator first, BidirectionalIterator last,
+                                         const std::vector<Modular>& prefix_products, Modular inverted_product) {
+                    if (prefix_products.empty()) {
+                        return;
+                    }
+
+                    std::size_t i = prefix_products.size() - 1;
+                    for (BidirectionalIterator it = last; it != first;) {
+                        --it;
+                        if (it->is_zero()) {
+                            continue;
+                        }
+                        if (i == 0) {
+                            *it = inverted_product;
+                            break;
+                        }
+                        Modular element_inverse = inverted_product * prefix_products[i - 1];
+                        inverted_product *= *it;
+                        *it = element_inverse;
+                        --i;
+                    }
+                }
+            }    // namespace detail
+
+            //
+            // Inverts all the modular numbers of [first, last) in place with Montgomery's trick: a single inversion
+            // and 3 * (n - 1) multiplications for n nonzero elements. Zero elements are skipped and stay zero,
+            // the other elements should share the same modulus. Returns false and leaves the range unchanged if
+            // some nonzero element is not invertible.
+            //
+            template<typename BidirectionalIterator>
+            bool batch_inverse_mod(BidirectionalIterator first, BidirectionalIterator last) {
+                typedef typename std::iterator_traits<BidirectionalIterator>::value_type modular_type;
+
+                std::vector<modular_type> prefix_products;
+                modular_type inverted_product;
+                if (!detail::batch_inverse_products(first, last, prefix_products, inverted_product)) {
+                    return false;
+                }
+                detail::batch_inverse_write(first, last, prefix_products, inverted_product);
+                return true;
+            }
+
         }    // namespace multiprecision
     }        // namespace crypto3
 }    // namespace nil
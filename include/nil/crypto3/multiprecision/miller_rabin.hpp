@@ -8,6 +8,10 @@
 
 #include <boost/random.hpp>
 #include <nil/crypto3/multiprecision/integer.hpp>
+#include <nil/crypto3/multiprecision/trial_division.hpp>
+
+#include <cstdint>
+#include <vector>
 
 namespace nil {
     namespace crypto3 {
@@ -15,7 +19,8 @@ namespace nil {
             namespace detail {
 
                 template<class I>
-                bool check_small_factors(const I& n) {
+                typename std::enable_if<!has_trial_division_kernel<I>::value, bool>::type
+                    check_small_factors(const I& n) {
                     constexpr const std::uint32_t small_factors1[] = {3u, 5u, 7u, 11u, 13u, 17u, 19u, 23u};
                     constexpr const std::uint32_t pp1 = 223092870u;
 
@@ -82,6 +87,17 @@ namespace nil {
                     return true;
                 }
 
+                //
+                // Trial division by the odd primes up to 227 packed into five 64-bit products
+                //
+                template<class I>
+                typename std::enable_if<has_trial_division_kernel<I>::value, bool>::type
+                    check_small_factors(const I& n) {
+                    static const trial_division_table table(48);
+                    BOOST_ASSERT(table.primes().back() == 227u);
+                    return !table.find_factor(n);
+                }
+
                 inline bool is_small_prime(unsigned n) {
                     constexpr const unsigned char p[] = {
                         3u,   5u,   7u,   11u,  13u,  17u,  19u,  23u,  29u,  31u,  37u,  41u,  43u,  47u,  53u,  59u,
@@ -105,8 +121,248 @@ namespace nil {
                     return val.template convert_to<unsigned>();
                 }
 
+                //
+                // Settles even n, n <= 227 and n with a prime factor up to 227, returns false for the rest
+                //
+                template<class I>
+                bool is_decided_by_small_primes(const I& n, bool& is_prime) {
+                    if (n == 2) {
+                        is_prime = true;
+                    } else if (bit_test(n, 0) == 0) {
+                        is_prime = false;
+                    } else if (n <= 227) {
+                        is_prime = is_small_prime(cast_to_unsigned(n));
+                    } else if (!check_small_factors(n)) {
+                        is_prime = false;
+                    } else {
+                        return false;
+                    }
+                    return true;
+                }
+
+                //
+                // Type wide enough to hold a product of two residues: a double width builtin or cpp_int for
+                // fixed width numbers
+                //
+                template<class I, bool = is_number<I>::value>
+                struct prime_test_wide_type {
+                    typedef typename double_integer<I>::type type;
+                };
+                template<class I>
+                struct prime_test_wide_type<I, true> {
+                    typedef typename std::conditional<std::numeric_limits<I>::is_bounded, cpp_int, I>::type type;
+                };
+
+                //
+                // Residues modulo an odd n as the prime tests see them: the generic version keeps plain residues
+                // and calls powm
+                //
+                template<class I, class Enable = void>
+                class prime_test_arithmetic {
+                    typedef typename prime_test_wide_type<I>::type wide_type;
+
+                public:
+                    typedef I element_type;
+
+                    explicit prime_test_arithmetic(const I& n) : m_n(n) {
+                    }
+
+                    element_type to_element(const I& x) {
+                        return element_type(x % m_n);
+                    }
+
+                    element_type one() {
+                        return element_type(1u);
+                    }
+
+                    void pow(element_type& result, const element_type& base, const I& exp) {
+                        result = powm(base, exp, m_n);
+                    }
+
+                    void mul(element_type& result, const element_type& x, const element_type& y) {
+                        result = static_cast<I>(wide_type(x) * wide_type(y) % wide_type(m_n));
+                    }
+
+                    void square(element_type& x) {
+                        mul(x, x, x);
+                    }
+
+                    /// the sum and the difference never leave [0, n), n may be close to the limit of a fixed width
+                    void add(element_type& result, const element_type& x, const element_type& y) {
+                        I complement(m_n - y);
+                        result = x >= complement ? I(x - complement) : I(x + y);
+                    }
+
+                    void sub(element_type& result, const element_type& x, const element_type& y) {
+                        result = x >= y ? I(x - y) : I(x + I(m_n - y));
+                    }
+
+                    void half(element_type& result, const element_type& x) {
+                        result = bit_test(x, 0) ? I((x >> 1u) + (m_n >> 1u) + 1u) : I(x >> 1u);
+                    }
+
+                private:
+                    I m_n;
+                };
+
+                //
+                // cpp_int with limbs storage keeps residues in Montgomery form of a single context built for n
+                //
+                template<unsigned MinBits, unsigned MaxBits, cpp_integer_type SignType, cpp_int_check_type Checked,
+                         class Allocator, expression_template_option ExpressionTemplates>
+                class prime_test_arithmetic<
+                    number<backends::cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>,
+                           ExpressionTemplates>,
+                    typename std::enable_if<!backends::is_trivial_cpp_int<
+                        backends::cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>>::value>::type> {
+                public:
+                    typedef number<backends::cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>,
+                                   ExpressionTemplates>
+                        number_type;
+                    typedef std::vector<limb_type> element_type;
+
+                    explicit prime_test_arithmetic(const number_type& n) : m_n(n), m_context(n.backend()) {
+                    }
+
+                    element_type to_element(const number_type& x) {
+                        element_type result =
+                            m_context.to_limbs(x < m_n ? x.backend() : number_type(x % m_n).backend());
+                        m_context.to_montgomery(result.data(), result.data());
+                        return result;
+                    }
+
+                    element_type one() {
+                        return m_context.one();
+                    }
+
+                    void pow(element_type& result, const element_type& base, const number_type& exp) {
+                        result.resize(base.size());
+                        m_context.exp(result.data(), base.data(), exp.backend());
+                    }
+
+                    void mul(element_type& result, const element_type& x, const element_type& y) {
+                        result.resize(x.size());
+                        m_context.mul(result.data(), x.data(), y.data());
+                    }
+
+                    void square(element_type& x) {
+                        m_context.sqr(x.data(), x.data());
+                    }
+
+                    void add(element_type& result, const element_type& x, const element_type& y) {
+                        result.resize(x.size());
+                        m_context.add(result.data(), x.data(), y.data());
+                    }
+
+                    void sub(element_type& result, const element_type& x, const element_type& y) {
+                        result.resize(x.size());
+                        m_context.sub(result.data(), x.data(), y.data());
+                    }
+
+                    void half(element_type& result, const element_type& x) {
+                        result.resize(x.size());
+                        m_context.half(result.data(), x.data());
+                    }
+
+                private:
+                    number_type m_n;
+                    backends::detail::montgomery_powm_context m_context;
+                };
             }    // namespace detail
 
+            //
+            // Miller-Rabin test of a fixed odd n > 3 against any count of witnesses. The reduction state of n is built
+            // once: for cpp_int it is a Montgomery context, 1 and n - 1 are kept in Montgomery form and every step of
+            // the squaring chain is a single Montgomery squaring.
+            //
+            template<class I>
+            class miller_rabin_engine {
+            protected:
+                typedef detail::prime_test_arithmetic<I> arithmetic_type;
+                typedef typename arithmetic_type::element_type element_type;
+
+            public:
+                explicit miller_rabin_engine(const I& n) : m_n(n), m_arithmetic(n) {
+                    BOOST_ASSERT(bit_test(n, 0) && n > 3u);
+
+                    m_q = n - 1u;
+                    m_k = lsb(m_q);
+                    m_q >>= m_k;
+
+                    m_zero = m_arithmetic.to_element(I(0u));
+                    m_one = m_arithmetic.one();
+                    m_minus_one = m_arithmetic.to_element(I(n - 1u));
+                }
+
+                const I& modulus() const {
+                    return m_n;
+                }
+
+                //
+                // true if n is a strong probable prime to base witness, witnesses divisible by n pass the test
+                //
+                bool is_strong_probable_prime(const I& witness) {
+                    element_type x = m_arithmetic.to_element(witness);
+                    if (x == m_zero) {
+                        return true;
+                    }
+
+                    m_arithmetic.pow(m_y, x, m_q);
+                    if (m_y == m_one || m_y == m_minus_one) {
+                        return true;
+                    }
+                    for (unsigned j = 1; j < m_k; ++j) {
+                        m_arithmetic.square(m_y);
+                        if (m_y == m_minus_one) {
+                            return true;
+                        }
+                        if (m_y == m_one) {
+                            return false;    // nontrivial square root of one
+                        }
+                    }
+                    return false;
+                }
+
+                //
+                // true if n passes the test for every witness of [first, last)
+                //
+                template<class Iterator>
+                bool test(Iterator first, Iterator last) {
+                    for (; first != last; ++first) {
+                        if (!is_strong_probable_prime(I(*first))) {
+                            return false;
+                        }
+                    }
+                    return true;
+                }
+
+                //
+                // true if n passes the test for trials witnesses uniformly distributed in [2, n - 2]
+                //
+                template<class Engine>
+                bool test(unsigned trials, Engine& gen) {
+                    boost::random::uniform_int_distribution<I> dist(2, I(m_n - 2u));
+                    for (unsigned i = 0; i < trials; ++i) {
+                        if (!is_strong_probable_prime(dist(gen))) {
+                            return false;
+                        }
+                    }
+                    return true;
+                }
+
+            protected:
+                I m_n, m_q;
+                unsigned m_k;
+                arithmetic_type m_arithmetic;
+                element_type m_zero, m_one, m_minus_one, m_y;
+            };
+
+            //
+            // Witnesses of a deterministic Miller-Rabin test for every n < 2^64 (J. Sinclair)
+            //
+            constexpr const std::uint64_t miller_rabin_witnesses_64[] = {2u,      325u,     9375u,      28178u,
+                                                                         450775u, 9780504u, 1795265022u};
+
             template<class I, class Engine>
             typename std::enable_if<number_category<I>::value == number_kind_integer, bool>::type
                 miller_rabin_test(const I& n, unsigned trials, Engine& gen) {
@@ -122,44 +378,34 @@ namespace nil {
                 if (!detail::check_small_factors(n))
                     return false;
 
-                number_type nm1 = n - 1;
+                miller_rabin_engine<number_type> engine(n);
                 //
-                // Begin with a single Fermat test - it excludes a lot of candidates:
+                // Begin with a single test to base 228 - it excludes a lot of candidates:
                 //
-                number_type q(228), x, y;    // We know n is greater than this, as we've excluded small factors
-                x = powm(q, nm1, n);
-                if (x != 1u)
+                if (!engine.is_strong_probable_prime(number_type(228)))
+                    return false;    // We know n is greater than this, as we've excluded small factors
+
+                if (!engine.test(trials, gen))
                     return false;
 
-                q = n - 1;
-                unsigned k = lsb(q);
-                q >>= k;
-
-                // Declare our random number generator:
-                boost::random::uniform_int_distribution<number_type> dist(2, n - 2);
-                //
-                // Execute the trials:
-                //
-                for (unsigned i = 0; i < trials; ++i) {
-                    x = dist(gen);
-                    y = powm(x, q, n);
-                    unsigned j = 0;
-                    while (true) {
-                        if (y == nm1)
-                            break;
-                        if (y == 1) {
-                            if (j == 0)
-                                break;
-                            return false;    // test failed
-                        }
-                        if (++j == k)
-                            return false;    // failed
-                        y = powm(y, 2, n);
-                    }
-                }
                 return true;    // Yeheh! probably prime.
             }
 
+            //
+            // Miller-Rabin test of n against the caller-supplied witnesses of [first_witness, last_witness), e.g.
+            // miller_rabin_witnesses_64 gives a deterministic answer for n < 2^64
+            //
+            template<class I, class Iterator>
+            typename std::enable_if<number_category<I>::value == number_kind_integer, bool>::type
+                miller_rabin_test(const I& n, Iterator first_witness, Iterator last_witness) {
+                bool is_prime;
+                if (detail::is_decided_by_small_primes(n, is_prime))
+                    return is_prime;
+
+                miller_rabin_engine<I> engine(n);
+                return engine.test(first_witness, last_witness);
+            }
+
             template<class I>
             typename std::enable_if<number_category<I>::value == number_kind_integer, bool>::type
                 miller_rabin_test(const I& x, unsigned trials) {
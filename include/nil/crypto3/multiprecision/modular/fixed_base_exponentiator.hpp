@@ -0,0 +1,134 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef BOOST_MULTIPRECISION_FIXED_BASE_EXPONENTIATOR_HPP
+#define BOOST_MULTIPRECISION_FIXED_BASE_EXPONENTIATOR_HPP
+
+#include <nil/crypto3/multiprecision/number.hpp>
+#include <nil/crypto3/multiprecision/modular/modular_adaptor.hpp>
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace nil {
+    namespace crypto3 {
+        namespace multiprecision {
+
+            //
+            // Exponentiation of a base fixed in advance (a generator in Diffie-Hellman or Schnorr verification).
+            // The exponent is split into windows of window_bits bits and the table keeps base^(d * 2^(w * i))
+            // for every digit d < 2^w and every window position i. base^e is then the product of one table entry
+            // per window of e: the same sequence of multiplications for any exponent of exp_bits bits and no
+            // squarings at all. Exponents longer than exp_bits are passed to powm.
+            //
+            template<typename Backend, typename ModularParamsHolder = void,
+                     expression_template_option ExpressionTemplates =
+                         expression_template_default<modular_adaptor<Backend, ModularParamsHolder>>::value>
+            class fixed_base_exponentiator {
+            public:
+                typedef number<modular_adaptor<Backend, ModularParamsHolder>, ExpressionTemplates> modular_type;
+
+                constexpr static std::size_t default_window_bits = 4;
+
+                //
+                // exp_bits defaults to the bit length of the modulus
+                //
+                explicit fixed_base_exponentiator(const modular_type& base, std::size_t exp_bits = 0,
+                                                  std::size_t window_bits = default_window_bits) :
+                    m_window_bits(window_bits) {
+                    BOOST_ASSERT(window_bits > 0 && window_bits < std::numeric_limits<std::size_t>::digits);
+
+                    m_exp_bits = exp_bits ? exp_bits : msb(base.backend().mod_data().get_mod()) + 1;
+                    m_windows_count = (m_exp_bits + m_window_bits - 1) / m_window_bits;
+                    precompute(base);
+                }
+
+                template<expression_template_option BaseExpressionTemplates>
+                fixed_base_exponentiator(const number<Backend, BaseExpressionTemplates>& base,
+                                         const modular_params<Backend>& mod, std::size_t exp_bits = 0,
+                                         std::size_t window_bits = default_window_bits) :
+                    fixed_base_exponentiator(modular_type(base, mod), exp_bits, window_bits) {
+                }
+
+                const modular_type& base() const {
+                    return m_table[1];
+                }
+
+                std::size_t exp_bits() const {
+                    return m_exp_bits;
+                }
+
+                std::size_t window_bits() const {
+                    return m_window_bits;
+                }
+
+                //
+                // base^e for nonnegative e
+                //
+                template<typename ExpBackend, expression_template_option ExpExpressionTemplates>
+                modular_type pow(const number<ExpBackend, ExpExpressionTemplates>& e) const {
+                    if (!e.is_zero() && msb(e) >= m_exp_bits) {
+                        return powm(base(), e);
+                    }
+
+                    const std::size_t digits_count = std::size_t(1u) << m_window_bits;
+
+                    modular_type result = m_table[window_digit(e, 0)];
+                    for (std::size_t i = 1; i < m_windows_count; ++i) {
+                        result *= m_table[i * digits_count + window_digit(e, i)];
+                    }
+                    return result;
+                }
+
+            protected:
+                //
+                // row i of the table holds base^(d * 2^(w * i)) for d = 0, ..., 2^w - 1,
+                // each row is built from the row before it by multiplications only
+                //
+                void precompute(const modular_type& base) {
+                    const std::size_t digits_count = std::size_t(1u) << m_window_bits;
+
+                    m_table.reserve(m_windows_count * digits_count);
+                    for (std::size_t i = 0; i < m_windows_count; ++i) {
+                        if (i == 0) {
+                            m_table.push_back(detail::modular_one(base));
+                            m_table.push_back(base);
+                        } else {
+                            /// row_base^(2^w) = row_base^(2^w - 1) * row_base of the previous row
+                            m_table.push_back(m_table[0]);
+                            m_table.push_back(m_table[i * digits_count - 1] * m_table[(i - 1) * digits_count + 1]);
+                        }
+
+                        const modular_type& row_base = m_table[i * digits_count + 1];
+                        for (std::size_t d = 2; d < digits_count; ++d) {
+                            m_table.push_back(m_table[i * digits_count + d - 1] * row_base);
+                        }
+                    }
+                }
+
+                template<typename ExpBackend, expression_template_option ExpExpressionTemplates>
+                std::size_t window_digit(const number<ExpBackend, ExpExpressionTemplates>& e, std::size_t i) const {
+                    std::size_t digit = 0;
+                    for (std::size_t j = 0; j < m_window_bits; ++j) {
+                        digit |= static_cast<std::size_t>(bit_test(e, static_cast<unsigned>(i * m_window_bits + j)))
+                                 << j;
+                    }
+                    return digit;
+                }
+
+                std::size_t m_exp_bits;
+                std::size_t m_window_bits;
+                std::size_t m_windows_count;
+                std::vector<modular_type> m_table;
+            };
+        }    // namespace multiprecision
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // BOOST_MULTIPRECISION_FIXED_BASE_EXPONENTIATOR_HPP
@@ -14,66 +14,12 @@
 #include <boost/type_traits/is_integral.hpp>
 
 #include <nil/crypto3/multiprecision/detail/default_ops.hpp>
+#include <nil/crypto3/multiprecision/cpp_int/detail/extended_euclidean.hpp>
 
 namespace nil {
     namespace crypto3 {
         namespace multiprecision {
             namespace backends {
-                template<typename Backend>
-                constexpr Backend eval_extended_euclidean_algorithm(Backend &num1, Backend& num2, Backend &bezout_x, Backend &bezout_y) {
-                    Backend x, y, tmp_num1 = num1, tmp_num2 = num2;
-                    using ui_type = typename std::tuple_element<0, typename Backend::unsigned_types>::type;
-                    y = ui_type(1u);
-                    bezout_x = ui_type(1u);
-
-                    // Extended Euclidean Algorithm
-                    while (!eval_is_zero(tmp_num2)) {
-                        Backend quotient, remainder, placeholder;
-
-                        eval_divide(quotient, tmp_num1, tmp_num2);
-                        eval_modulus(remainder, tmp_num1, tmp_num2);
-
-                        tmp_num1 = tmp_num2;
-                        tmp_num2 = remainder;
-
-                        Backend temp_x = x, temp_y = y;
-                        eval_multiply(placeholder, quotient, x);
-                        eval_subtract(placeholder, bezout_x, placeholder);
-                        x = placeholder;
-                        bezout_x = temp_x;
-
-                        eval_multiply(placeholder, quotient, y);
-                        eval_subtract(placeholder, bezout_y, placeholder);
-                        y = placeholder;
-                        bezout_y = temp_y;
-
-                    }
-                    return tmp_num1;
-                }
-
-                    // a^(-1) mod p
-                // http://www-math.ucdenver.edu/~wcherowi/courses/m5410/exeucalg.html
-                template<typename Backend>
-                constexpr void eval_inverse_extended_euclidean_algorithm(Backend &result, const Backend& a, const Backend& m) {
-                    using Backend_doubled = typename default_ops::double_precision_type<Backend>::type;
-                    using ui_type = typename std::tuple_element<0, typename Backend::unsigned_types>::type;
-
-                    Backend aa = a, mm = m, x, y, g;
-                    Backend zero;
-                    zero = ui_type(0u);
-                    g = eval_extended_euclidean_algorithm(aa, mm, x, y);
-                    if (!eval_eq(g, ui_type(1u))) {
-                        // BOOST_THROW_EXCEPTION(std::invalid_argument("eval_inverse_with_gcd: no inverse element"));
-                        result = zero;
-                    } else {
-                        eval_modulus(x, m);
-                        Backend_doubled tmp(x);
-                        eval_add(tmp, m);
-                        eval_modulus(tmp, m);
-                        result = static_cast<Backend>(tmp);
-                    }
-                }
-
                 template<typename Backend>
                 constexpr void eval_inverse_mod_pow2(Backend &result, const Backend &a, const size_t &k) {
                     using ui_type = typename std::tuple_element<0, typename Backend::unsigned_types>::type;
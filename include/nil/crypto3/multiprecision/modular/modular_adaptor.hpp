@@ -31,8 +31,11 @@ namespace nil {
         namespace multiprecision {
             namespace backends {
 
-                template<typename Backend>
+                template<typename Backend, typename ModularParamsHolder>
                 struct modular_adaptor {
+                    static_assert(std::is_void<ModularParamsHolder>::value,
+                                  "shared modular params are supported for fixed precision backends only");
+
                     typedef modular_params<Backend> modulus_type;
                     typedef Backend backend_type;
 
@@ -193,9 +196,9 @@ namespace nil {
                     eval_convert_to(result, val.base_data());
                 }
 
-                template<class Backend, class T>
+                template<class Backend, class ModularParamsHolder, class T>
                 constexpr typename boost::enable_if<boost::is_arithmetic<T>, bool>::type
-                    eval_eq(const modular_adaptor<Backend>& a, const T& b) {
+                    eval_eq(const modular_adaptor<Backend, ModularParamsHolder>& a, const T& b) {
                     return a.compare(b) == 0;
                 }
 
@@ -218,6 +221,9 @@ namespace nil {
 
                 template<class Backend>
                 constexpr void eval_subtract(modular_adaptor<Backend>& result, const modular_adaptor<Backend>& o) {
+                    static_assert(!is_unsigned_number<Backend>::value,
+                                  "the difference of two residues is negative before the correction, the backend "
+                                  "should be signed");
                     BOOST_ASSERT(result.mod_data().get_mod() == o.mod_data().get_mod());
                     using ui_type = typename std::tuple_element<0, typename Backend::unsigned_types>::type;
                     using default_ops::eval_lt;
@@ -360,7 +366,8 @@ namespace nil {
                     for (size_t i = exp_nibbles - 1; i > 0; --i) {
 
                         for (size_t j = 0; j != m_window_bits; ++j) {
-                            x = x * x;
+                            /// in-place squaring, so that the operands aliasing is visible to the backend
+                            eval_multiply(x.backend(), x.backend());
                         }
 
                         x = x * m_g[exp_index[i - 1]];
@@ -557,20 +564,40 @@ namespace nil {
 
             using nil::crypto3::multiprecision::backends::modular_adaptor;
 
-            template<class Backend>
-            struct number_category<modular_adaptor<Backend>>
+            template<class Backend, class ModularParamsHolder>
+            struct number_category<modular_adaptor<Backend, ModularParamsHolder>>
                 : public std::integral_constant<int, nil::crypto3::multiprecision::number_kind_modular> { };
 
-            template<class Backend, expression_template_option ExpressionTemplates>
-            struct component_type<number<modular_adaptor<Backend>, ExpressionTemplates>> {
+            template<class Backend, class ModularParamsHolder, expression_template_option ExpressionTemplates>
+            struct component_type<number<modular_adaptor<Backend, ModularParamsHolder>, ExpressionTemplates>> {
                 typedef number<Backend, ExpressionTemplates> type;
             };
 
             template<class T>
             struct is_modular_number : public std::integral_constant<bool, false> { };
 
-            template<class Backend, expression_template_option ExpressionTemplates>
-            struct is_modular_number<number<backends::modular_adaptor<Backend>, ExpressionTemplates>> : public std::integral_constant<bool, true> { };
+            template<class Backend, class ModularParamsHolder, expression_template_option ExpressionTemplates>
+            struct is_modular_number<number<backends::modular_adaptor<Backend, ModularParamsHolder>, ExpressionTemplates>>
+                : public std::integral_constant<bool, true> { };
+
+            namespace detail {
+                //
+                // one in the modular form of the modulus of x
+                //
+                template<class Backend, expression_template_option ExpressionTemplates>
+                number<modular_adaptor<Backend>, ExpressionTemplates>
+                    modular_one(const number<modular_adaptor<Backend>, ExpressionTemplates>& x) {
+                    return number<modular_adaptor<Backend>, ExpressionTemplates>(1u, x.backend().mod_data());
+                }
+
+                template<class Backend, class ModularParamsHolder, expression_template_option ExpressionTemplates>
+                typename std::enable_if<
+                    !std::is_void<ModularParamsHolder>::value,
+                    number<modular_adaptor<Backend, ModularParamsHolder>, ExpressionTemplates>>::type
+                    modular_one(const number<modular_adaptor<Backend, ModularParamsHolder>, ExpressionTemplates>&) {
+                    return number<modular_adaptor<Backend, ModularParamsHolder>, ExpressionTemplates>(1u);
+                }
+            }    // namespace detail
         }    // namespace multiprecision
     }        // namespace crypto3
 }    // namespace nil
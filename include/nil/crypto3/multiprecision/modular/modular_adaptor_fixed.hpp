@@ -17,7 +17,7 @@ namespace nil {
         namespace multiprecision {
             namespace backends {
 
-                template<typename Backend>
+                template<typename Backend, typename ModularParamsHolder = void>
                 class modular_adaptor;
 
                 // fixed precision modular backend which supports compile-time execution
@@ -175,6 +175,100 @@ namespace nil {
                     modulus_type m_mod;
                 };
 
+                // fixed precision modular backend which stores limbs only, modular params are shared by all the
+                // elements and are provided by ModularParamsHolder::mod_data(), e.g. shared_modular_params
+                template<unsigned MinBits, cpp_integer_type SignType, cpp_int_check_type Checked,
+                         typename ModularParamsHolder>
+                class modular_adaptor<modular_fixed_cpp_int_backend<MinBits, SignType, Checked>, ModularParamsHolder> {
+                protected:
+                    typedef modular_fixed_cpp_int_backend<MinBits, SignType, Checked> Backend;
+
+                public:
+                    typedef modular_params<Backend> modulus_type;
+                    typedef Backend backend_type;
+                    typedef ModularParamsHolder params_holder_type;
+
+                    constexpr Backend& base_data() {
+                        return m_base;
+                    }
+                    constexpr const Backend& base_data() const {
+                        return m_base;
+                    }
+                    static constexpr const modulus_type& mod_data() {
+                        return ModularParamsHolder::mod_data();
+                    }
+
+                    typedef typename Backend::signed_types signed_types;
+                    typedef typename Backend::unsigned_types unsigned_types;
+
+                    constexpr modular_adaptor() {
+                    }
+
+                    constexpr modular_adaptor(const modular_adaptor& o) : m_base(o.base_data()) {
+                    }
+
+                    constexpr modular_adaptor(const Backend& b) {
+                        mod_data().adjust_modular(m_base, b);
+                    }
+
+                    template<typename T, typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
+                    constexpr modular_adaptor(const T& v) {
+                        mod_data().adjust_modular(m_base, Backend(v));
+                    }
+
+                    template<typename T, typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
+                    constexpr modular_adaptor& operator=(const T& v) {
+                        mod_data().adjust_modular(m_base, Backend(v));
+                        return *this;
+                    }
+
+                    modular_adaptor& operator=(const char* s) {
+                        Backend tmp;
+                        tmp = s;
+                        mod_data().adjust_modular(m_base, tmp);
+                        return *this;
+                    }
+
+                    constexpr modular_adaptor& operator=(const modular_adaptor& o) {
+                        m_base = o.base_data();
+                        return *this;
+                    }
+
+                    constexpr int compare(const modular_adaptor& o) const {
+                        Backend tmp1, tmp2;
+                        mod_data().adjust_regular(tmp1, base_data());
+                        mod_data().adjust_regular(tmp2, o.base_data());
+                        return tmp1.compare(tmp2);
+                    }
+
+                    template<typename T>
+                    constexpr int compare(const T& a) const {
+                        return compare(modular_adaptor(Backend(a)));
+                    }
+
+                    constexpr void swap(modular_adaptor& o) {
+                        base_data().swap(o.base_data());
+                    }
+
+                    inline std::string str(std::streamsize dig, std::ios_base::fmtflags f) const {
+                        Backend tmp;
+                        mod_data().adjust_regular(tmp, base_data());
+                        return tmp.str(dig, f);
+                    }
+
+                    constexpr void negate() {
+                        using default_ops::eval_is_zero;
+                        if (!eval_is_zero(m_base)) {
+                            Backend tmp = mod_data().get_mod().backend();
+                            eval_subtract(tmp, m_base);
+                            m_base = tmp;
+                        }
+                    }
+
+                protected:
+                    Backend m_base;
+                };
+
                 template<unsigned MinBits, cpp_integer_type SignType, cpp_int_check_type Checked, typename Backend1,
                          typename Backend2>
                 constexpr void assign_components(
@@ -215,7 +309,25 @@ namespace nil {
                     eval_multiply(modular_adaptor<modular_fixed_cpp_int_backend<MinBits, SignType, Checked>>& result,
                                   const modular_adaptor<modular_fixed_cpp_int_backend<MinBits, SignType, Checked>>& o) {
                     BOOST_ASSERT(result.mod_data().get_mod() == o.mod_data().get_mod());
-                    result.mod_data().mod_mul(result.base_data(), o.base_data());
+                    if (&result == &o) {
+                        result.mod_data().mod_sqr(result.base_data());
+                    } else {
+                        result.mod_data().mod_mul(result.base_data(), o.base_data());
+                    }
+                }
+
+                template<unsigned MinBits, cpp_integer_type SignType, cpp_int_check_type Checked>
+                constexpr void
+                    eval_multiply(modular_adaptor<modular_fixed_cpp_int_backend<MinBits, SignType, Checked>>& result,
+                                  const modular_adaptor<modular_fixed_cpp_int_backend<MinBits, SignType, Checked>>& a,
+                                  const modular_adaptor<modular_fixed_cpp_int_backend<MinBits, SignType, Checked>>& b) {
+                    BOOST_ASSERT(a.mod_data().get_mod() == b.mod_data().get_mod());
+                    result.mod_data() = a.mod_data();
+                    if (&a == &b) {
+                        result.mod_data().mod_sqr(result.base_data(), a.base_data());
+                    } else {
+                        result.mod_data().mod_mul(result.base_data(), a.base_data(), b.base_data());
+                    }
                 }
 
                 template<unsigned MinBits, cpp_integer_type SignType, cpp_int_check_type Checked, typename Backend>
@@ -280,14 +392,151 @@ namespace nil {
                 template<unsigned MinBits, cpp_integer_type SignType, cpp_int_check_type Checked>
                 constexpr void eval_inverse_mod(modular_adaptor<modular_fixed_cpp_int_backend<MinBits, SignType, Checked>>& result,
                                                 const modular_adaptor<modular_fixed_cpp_int_backend<MinBits, SignType, Checked>>& input) {
+                    result.mod_data() = input.mod_data();
+                    input.mod_data().mod_inverse(result.base_data(), input.base_data());
+                }
+
+                template<unsigned MinBits, cpp_integer_type SignType, cpp_int_check_type Checked,
+                         typename ModularParamsHolder>
+                constexpr typename std::enable_if<!std::is_void<ModularParamsHolder>::value>::type eval_add(
+                    modular_adaptor<modular_fixed_cpp_int_backend<MinBits, SignType, Checked>, ModularParamsHolder>&
+                        result,
+                    const modular_adaptor<modular_fixed_cpp_int_backend<MinBits, SignType, Checked>,
+                                          ModularParamsHolder>& o) {
+                    result.mod_data().mod_add(result.base_data(), o.base_data());
+                }
+
+                template<unsigned MinBits, cpp_integer_type SignType, cpp_int_check_type Checked,
+                         typename ModularParamsHolder>
+                constexpr typename std::enable_if<!std::is_void<ModularParamsHolder>::value>::type eval_subtract(
+                    modular_adaptor<modular_fixed_cpp_int_backend<MinBits, SignType, Checked>, ModularParamsHolder>&
+                        result,
+                    const modular_adaptor<modular_fixed_cpp_int_backend<MinBits, SignType, Checked>,
+                                          ModularParamsHolder>& o) {
+                    using default_ops::eval_get_sign;
+
+                    static_assert(!is_unsigned_number<modular_fixed_cpp_int_backend<MinBits, SignType, Checked>>::value,
+                                  "the difference of two residues is negative before the correction, the backend "
+                                  "should be signed");
+
+                    /// both values are reduced, so the difference fits the signed backend and a single correction is
+                    /// enough
+                    eval_subtract(result.base_data(), o.base_data());
+                    if (eval_get_sign(result.base_data()) < 0) {
+                        eval_add(result.base_data(), result.mod_data().get_mod().backend());
+                    }
+                }
+
+                template<unsigned MinBits, cpp_integer_type SignType, cpp_int_check_type Checked,
+                         typename ModularParamsHolder>
+                constexpr typename std::enable_if<!std::is_void<ModularParamsHolder>::value>::type eval_multiply(
+                    modular_adaptor<modular_fixed_cpp_int_backend<MinBits, SignType, Checked>, ModularParamsHolder>&
+                        result,
+                    const modular_adaptor<modular_fixed_cpp_int_backend<MinBits, SignType, Checked>,
+                                          ModularParamsHolder>& o) {
+                    if (&result == &o) {
+                        result.mod_data().mod_sqr(result.base_data());
+                    } else {
+                        result.mod_data().mod_mul(result.base_data(), o.base_data());
+                    }
+                }
+
+                template<unsigned MinBits, cpp_integer_type SignType, cpp_int_check_type Checked,
+                         typename ModularParamsHolder>
+                constexpr typename std::enable_if<!std::is_void<ModularParamsHolder>::value>::type eval_multiply(
+                    modular_adaptor<modular_fixed_cpp_int_backend<MinBits, SignType, Checked>, ModularParamsHolder>&
+                        result,
+                    const modular_adaptor<modular_fixed_cpp_int_backend<MinBits, SignType, Checked>,
+                                          ModularParamsHolder>& a,
+                    const modular_adaptor<modular_fixed_cpp_int_backend<MinBits, SignType, Checked>,
+                                          ModularParamsHolder>& b) {
+                    if (&a == &b) {
+                        result.mod_data().mod_sqr(result.base_data(), a.base_data());
+                    } else {
+                        result.mod_data().mod_mul(result.base_data(), a.base_data(), b.base_data());
+                    }
+                }
+
+                template<unsigned MinBits, cpp_integer_type SignType, cpp_int_check_type Checked,
+                         typename ModularParamsHolder, typename T>
+                constexpr typename std::enable_if<!std::is_void<ModularParamsHolder>::value>::type eval_pow(
+                    modular_adaptor<modular_fixed_cpp_int_backend<MinBits, SignType, Checked>, ModularParamsHolder>&
+                        result,
+                    const modular_adaptor<modular_fixed_cpp_int_backend<MinBits, SignType, Checked>,
+                                          ModularParamsHolder>& b,
+                    const T& e) {
+                    result.mod_data().mod_exp(result.base_data(), b.base_data(), e);
+                }
+
+                template<unsigned MinBits, cpp_integer_type SignType, cpp_int_check_type Checked,
+                         typename ModularParamsHolder>
+                constexpr typename std::enable_if<!std::is_void<ModularParamsHolder>::value>::type eval_pow(
+                    modular_adaptor<modular_fixed_cpp_int_backend<MinBits, SignType, Checked>, ModularParamsHolder>&
+                        result,
+                    const modular_adaptor<modular_fixed_cpp_int_backend<MinBits, SignType, Checked>,
+                                          ModularParamsHolder>& b,
+                    const modular_adaptor<modular_fixed_cpp_int_backend<MinBits, SignType, Checked>,
+                                          ModularParamsHolder>& e) {
                     using Backend = modular_fixed_cpp_int_backend<MinBits, SignType, Checked>;
-                    using Backend_padded_limbs = typename modular_params<Backend>::policy_type::Backend_padded_limbs;
 
-                    Backend_padded_limbs new_base, res, tmp = input.mod_data().get_mod().backend();
+                    Backend exp;
+                    e.mod_data().adjust_regular(exp, e.base_data());
+                    eval_pow(result, b, exp);
+                }
 
-                    input.mod_data().adjust_regular(new_base, input.base_data());
-                    eval_inverse_mod(res, new_base, tmp);
-                    assign_components(result, res, input.mod_data().get_mod().backend());
+                template<unsigned MinBits, cpp_integer_type SignType, cpp_int_check_type Checked,
+                         typename ModularParamsHolder, typename T>
+                constexpr typename std::enable_if<!std::is_void<ModularParamsHolder>::value>::type eval_powm(
+                    modular_adaptor<modular_fixed_cpp_int_backend<MinBits, SignType, Checked>, ModularParamsHolder>&
+                        result,
+                    const modular_adaptor<modular_fixed_cpp_int_backend<MinBits, SignType, Checked>,
+                                          ModularParamsHolder>& b,
+                    const T& e) {
+                    eval_pow(result, b, e);
+                }
+
+                template<unsigned MinBits, cpp_integer_type SignType, cpp_int_check_type Checked,
+                         typename ModularParamsHolder>
+                constexpr typename std::enable_if<!std::is_void<ModularParamsHolder>::value>::type eval_inverse_mod(
+                    modular_adaptor<modular_fixed_cpp_int_backend<MinBits, SignType, Checked>, ModularParamsHolder>&
+                        result,
+                    const modular_adaptor<modular_fixed_cpp_int_backend<MinBits, SignType, Checked>,
+                                          ModularParamsHolder>& input) {
+                    input.mod_data().mod_inverse(result.base_data(), input.base_data());
+                }
+
+                template<unsigned MinBits, cpp_integer_type SignType, cpp_int_check_type Checked,
+                         typename ModularParamsHolder>
+                constexpr typename std::enable_if<!std::is_void<ModularParamsHolder>::value, bool>::type
+                    eval_is_zero(const modular_adaptor<modular_fixed_cpp_int_backend<MinBits, SignType, Checked>,
+                                                       ModularParamsHolder>& val) {
+                    using default_ops::eval_is_zero;
+                    return eval_is_zero(val.base_data());
+                }
+
+                template<unsigned MinBits, cpp_integer_type SignType, cpp_int_check_type Checked,
+                         typename ModularParamsHolder>
+                constexpr typename std::enable_if<!std::is_void<ModularParamsHolder>::value, int>::type
+                    eval_get_sign(const modular_adaptor<modular_fixed_cpp_int_backend<MinBits, SignType, Checked>,
+                                                        ModularParamsHolder>& val) {
+                    using default_ops::eval_is_zero;
+                    return eval_is_zero(val.base_data()) ? 0 : 1;
+                }
+
+                //
+                // exponentiation with exponent-independent sequence of modular operations, see
+                // modular_functions_fixed::montgomery_exp_fixed_window
+                //
+                template<unsigned MinBits, cpp_integer_type SignType, cpp_int_check_type Checked,
+                         typename ModularParamsHolder, typename T>
+                constexpr void eval_powm_fixed_window(
+                    modular_adaptor<modular_fixed_cpp_int_backend<MinBits, SignType, Checked>, ModularParamsHolder>&
+                        result,
+                    const modular_adaptor<modular_fixed_cpp_int_backend<MinBits, SignType, Checked>,
+                                          ModularParamsHolder>& b,
+                    const T& e) {
+                    result = b;
+                    result.mod_data().mod_exp_fixed_window(result.base_data(), e);
                 }
 
             }    // namespace backends
@@ -296,11 +545,22 @@ namespace nil {
             using backends::modular_adaptor;
             using backends::modular_fixed_cpp_int_backend;
 
-            template<unsigned MinBits, cpp_integer_type SignType, cpp_int_check_type Checked>
+            template<unsigned MinBits, cpp_integer_type SignType, cpp_int_check_type Checked,
+                     typename ModularParamsHolder>
             struct expression_template_default<
-                modular_adaptor<modular_fixed_cpp_int_backend<MinBits, SignType, Checked>>> {
+                modular_adaptor<modular_fixed_cpp_int_backend<MinBits, SignType, Checked>, ModularParamsHolder>> {
                 static const expression_template_option value = et_off;
             };
+
+            template<typename Backend, typename ModularParamsHolder, expression_template_option ExpressionTemplates,
+                     typename ExpBackend, expression_template_option ExpExpressionTemplates>
+            constexpr number<modular_adaptor<Backend, ModularParamsHolder>, ExpressionTemplates>
+                powm_fixed_window(const number<modular_adaptor<Backend, ModularParamsHolder>, ExpressionTemplates>& b,
+                                  const number<ExpBackend, ExpExpressionTemplates>& e) {
+                number<modular_adaptor<Backend, ModularParamsHolder>, ExpressionTemplates> result;
+                backends::eval_powm_fixed_window(result.backend(), b.backend(), e.backend());
+                return result;
+            }
         }    // namespace multiprecision
     }        // namespace crypto3
 }    // namespace nil
@@ -11,6 +11,9 @@
 #define BOOST_MULTIPRECISION_MODULAR_FUNCTIONS_FIXED_PRECISION_HPP
 
 #include <nil/crypto3/multiprecision/modular/modular_policy_fixed.hpp>
+#include <nil/crypto3/multiprecision/modular/montgomery_mul_fixed.hpp>
+#include <nil/crypto3/multiprecision/modular/safegcd_inverse_fixed.hpp>
+#include <nil/crypto3/multiprecision/detail/sliding_window.hpp>
 
 #include <boost/mpl/if.hpp>
 
@@ -200,6 +203,7 @@ namespace nil {
                     typedef typename policy_type::number_type_u number_type_u;
                     typedef typename policy_type::dbl_lmb_number_type dbl_lmb_number_type;
 
+                    constexpr static auto limbs_count = policy_type::limbs_count;
                     constexpr static auto limb_bits = policy_type::limb_bits;
 
                     constexpr void initialize_modulus(const number_type& m) {
@@ -506,6 +510,57 @@ namespace nil {
                              typename = typename boost::enable_if_c<max_precision<Backend1>::value >=
                                                                     max_precision<Backend>::value>::type>
                     constexpr void montgomery_mul(Backend1& result, const Backend2& x, const Backend3& y) const {
+                        //
+                        // modulus occupying all the limbs of the backend is the common case of fixed fields,
+                        // loops bounds are known at compile time then and could be unrolled
+                        //
+                        if (get_mod().backend().size() == limbs_count) {
+#ifndef BOOST_MP_NO_CONSTEXPR_DETECTION
+                            if (!BOOST_MP_IS_CONST_EVALUATED(get_mod().backend().size())) {
+                                montgomery_mul_kernel_impl(
+                                    result, x, y,
+                                    std::integral_constant<bool, has_montgomery_mul_kernel<limbs_count>::value>());
+                                return;
+                            }
+#endif
+                            montgomery_mul_impl(result, x, y, std::integral_constant<std::size_t, limbs_count>());
+                        } else {
+                            montgomery_mul_impl(result, x, y, static_cast<std::size_t>(get_mod().backend().size()));
+                        }
+                    }
+
+                    template<typename Backend1, typename Backend2, typename Backend3>
+                    void montgomery_mul_kernel_impl(Backend1& result, const Backend2& x, const Backend3& y,
+                                                    std::true_type) const {
+                        limb_type x_limbs[limbs_count], y_limbs[limbs_count], result_limbs[limbs_count];
+                        for (std::size_t i = 0; i < limbs_count; ++i) {
+                            x_limbs[i] = get_limb_value(x, i);
+                            y_limbs[i] = get_limb_value(y, i);
+                        }
+
+                        montgomery_mul_kernel<limbs_count>(result_limbs, x_limbs, y_limbs,
+                                                           get_mod().backend().limbs(), get_p_dash());
+
+                        result.resize(limbs_count, limbs_count);
+                        for (std::size_t i = 0; i < limbs_count; ++i) {
+                            result.limbs()[i] = result_limbs[i];
+                        }
+                        result.sign(false);
+                        result.normalize();
+                    }
+
+                    template<typename Backend1, typename Backend2, typename Backend3>
+                    constexpr void montgomery_mul_kernel_impl(Backend1& result, const Backend2& x, const Backend3& y,
+                                                              std::false_type) const {
+                        montgomery_mul_impl(result, x, y, std::integral_constant<std::size_t, limbs_count>());
+                    }
+
+                    //
+                    // mod_size is either std::size_t or std::integral_constant holding size of the modulus in limbs
+                    //
+                    template<typename Backend1, typename Backend2, typename Backend3, typename SizeType>
+                    constexpr void montgomery_mul_impl(Backend1& result, const Backend2& x, const Backend3& y,
+                                                       const SizeType mod_size) const {
                         using default_ops::eval_bitwise_and;
                         using default_ops::eval_lt;
                         using default_ops::eval_subtract;
@@ -516,7 +571,7 @@ namespace nil {
 
                         Backend_padded_limbs A(internal_limb_type(0u));
 
-                        for (auto i = 0; i < get_mod().backend().size(); i++) {
+                        for (std::size_t i = 0; i < mod_size; i++) {
                             internal_limb_type u_i =
                                 (A.limbs()[0] + get_limb_value(x, i) * get_limb_value(y, 0)) * get_p_dash();
 
@@ -535,7 +590,7 @@ namespace nil {
                             k = static_cast<internal_limb_type>(z >> std::numeric_limits<internal_limb_type>::digits);
                             k2 = static_cast<internal_limb_type>(z2 >> std::numeric_limits<internal_limb_type>::digits);
 
-                            for (auto j = 1; j < get_mod().backend().size(); ++j) {
+                            for (std::size_t j = 1; j < mod_size; ++j) {
                                 internal_double_limb_type t =
                                     static_cast<internal_double_limb_type>(get_limb_value(y, j)) *
                                         static_cast<internal_double_limb_type>(get_limb_value(x, i)) +
@@ -552,19 +607,19 @@ namespace nil {
                             }
                             internal_double_limb_type tmp =
                                 static_cast<internal_double_limb_type>(
-                                    custom_get_limb_value<internal_limb_type>(A, get_mod().backend().size())) +
+                                    custom_get_limb_value<internal_limb_type>(A, mod_size)) +
                                 k + k2;
-                            custom_set_limb_value<internal_limb_type>(A, get_mod().backend().size() - 1,
+                            custom_set_limb_value<internal_limb_type>(A, mod_size - 1,
                                                                       static_cast<internal_limb_type>(tmp));
                             custom_set_limb_value<internal_limb_type>(
-                                A, get_mod().backend().size(),
+                                A, mod_size,
                                 static_cast<internal_limb_type>(tmp >>
                                                                 std::numeric_limits<internal_limb_type>::digits));
                         }
                         //
                         // recover correct size of backend content
                         //
-                        adjust_backend_size(A, get_mod().backend().size());
+                        adjust_backend_size(A, mod_size);
 
                         if (!eval_lt(A, get_mod().backend())) {
                             eval_subtract(A, get_mod().backend());
@@ -574,6 +629,239 @@ namespace nil {
                         result = A;
                     }
 
+                    //
+                    // t[0..2 * mod_size) = x^2, every cross product x_i * x_j (i < j) is computed once and doubled,
+                    // t should be zero-initialized
+                    //
+                    template<typename Backend1, typename SizeType>
+                    constexpr void square_limbs(internal_limb_type* t, const Backend1& x,
+                                                const SizeType mod_size) const {
+                        for (std::size_t i = 0; i + 1 < mod_size; ++i) {
+                            internal_limb_type k = 0;
+                            for (std::size_t j = i + 1; j < mod_size; ++j) {
+                                internal_double_limb_type z =
+                                    static_cast<internal_double_limb_type>(get_limb_value(x, i)) *
+                                        static_cast<internal_double_limb_type>(get_limb_value(x, j)) +
+                                    t[i + j] + k;
+                                t[i + j] = static_cast<internal_limb_type>(z);
+                                k = static_cast<internal_limb_type>(z >>
+                                                                    std::numeric_limits<internal_limb_type>::digits);
+                            }
+                            t[i + mod_size] = k;
+                        }
+
+                        internal_limb_type high_bit = 0;
+                        for (std::size_t i = 0; i < 2 * mod_size; ++i) {
+                            internal_limb_type next_high_bit = t[i] >> (limb_bits - 1);
+                            t[i] = (t[i] << 1u) | high_bit;
+                            high_bit = next_high_bit;
+                        }
+
+                        internal_limb_type k = 0;
+                        for (std::size_t i = 0; i < mod_size; ++i) {
+                            internal_double_limb_type z =
+                                static_cast<internal_double_limb_type>(get_limb_value(x, i)) *
+                                    static_cast<internal_double_limb_type>(get_limb_value(x, i)) +
+                                t[2 * i] + k;
+                            t[2 * i] = static_cast<internal_limb_type>(z);
+                            z = static_cast<internal_double_limb_type>(t[2 * i + 1]) +
+                                (z >> std::numeric_limits<internal_limb_type>::digits);
+                            t[2 * i + 1] = static_cast<internal_limb_type>(z);
+                            k = static_cast<internal_limb_type>(z >> std::numeric_limits<internal_limb_type>::digits);
+                        }
+                    }
+
+                    template<typename Backend1>
+                    constexpr void regular_sqr(Backend1& result) const {
+                        regular_sqr(result, result);
+                    }
+
+                    template<typename Backend1, typename Backend2,
+                             /// result should fit in the output parameter
+                             typename = typename boost::enable_if_c<max_precision<Backend1>::value >=
+                                                                    max_precision<Backend>::value>::type>
+                    constexpr void regular_sqr(Backend1& result, const Backend2& x) const {
+                        regular_sqr_impl(result, x,
+                                         std::integral_constant<bool, is_trivial_cpp_int<Backend>::value>());
+                    }
+
+                    template<typename Backend1, typename Backend2>
+                    constexpr void regular_sqr_impl(Backend1& result, const Backend2& x, std::true_type) const {
+                        regular_mul(result, x, x);
+                    }
+
+                    template<typename Backend1, typename Backend2>
+                    constexpr void regular_sqr_impl(Backend1& result, const Backend2& x, std::false_type) const {
+                        /// input parameter should be lesser than modulus
+                        const std::size_t mod_size = get_mod().backend().size();
+                        internal_limb_type t[2 * limbs_count] = {0};
+                        square_limbs(t, x, mod_size);
+
+                        Backend_doubled_limbs tmp;
+                        tmp.resize(2 * mod_size, 2 * mod_size);
+                        for (std::size_t i = 0; i < 2 * mod_size; ++i) {
+                            tmp.limbs()[i] = t[i];
+                        }
+                        tmp.normalize();
+                        barrett_reduce(result, tmp);
+                    }
+
+                    template<typename Backend1>
+                    constexpr void montgomery_sqr(Backend1& result) const {
+                        montgomery_sqr(result, result);
+                    }
+
+                    template<typename Backend1, typename Backend2,
+                             /// result should fit in the output parameter
+                             typename = typename boost::enable_if_c<max_precision<Backend1>::value >=
+                                                                    max_precision<Backend>::value>::type>
+                    constexpr void montgomery_sqr(Backend1& result, const Backend2& x) const {
+                        montgomery_sqr_dispatch(result, x,
+                                                std::integral_constant<bool, is_trivial_cpp_int<Backend>::value>());
+                    }
+
+                    template<typename Backend1, typename Backend2>
+                    constexpr void montgomery_sqr_dispatch(Backend1& result, const Backend2& x, std::true_type) const {
+                        montgomery_mul(result, x, x);
+                    }
+
+                    template<typename Backend1, typename Backend2>
+                    constexpr void montgomery_sqr_dispatch(Backend1& result, const Backend2& x, std::false_type) const {
+                        if (get_mod().backend().size() == limbs_count) {
+#ifndef BOOST_MP_NO_CONSTEXPR_DETECTION
+                            if (!BOOST_MP_IS_CONST_EVALUATED(get_mod().backend().size())) {
+                                montgomery_sqr_kernel_impl(
+                                    result, x,
+                                    std::integral_constant<bool, has_montgomery_mul_kernel<limbs_count>::value>());
+                                return;
+                            }
+#endif
+                            montgomery_sqr_impl(result, x, std::integral_constant<std::size_t, limbs_count>());
+                        } else {
+                            montgomery_sqr_impl(result, x, static_cast<std::size_t>(get_mod().backend().size()));
+                        }
+                    }
+
+                    template<typename Backend1, typename Backend2>
+                    void montgomery_sqr_kernel_impl(Backend1& result, const Backend2& x, std::true_type) const {
+                        limb_type x_limbs[limbs_count], result_limbs[limbs_count];
+                        for (std::size_t i = 0; i < limbs_count; ++i) {
+                            x_limbs[i] = get_limb_value(x, i);
+                        }
+
+                        montgomery_sqr_kernel<limbs_count>(result_limbs, x_limbs, get_mod().backend().limbs(),
+                                                           get_p_dash());
+
+                        result.resize(limbs_count, limbs_count);
+                        for (std::size_t i = 0; i < limbs_count; ++i) {
+                            result.limbs()[i] = result_limbs[i];
+                        }
+                        result.sign(false);
+                        result.normalize();
+                    }
+
+                    template<typename Backend1, typename Backend2>
+                    constexpr void montgomery_sqr_kernel_impl(Backend1& result, const Backend2& x,
+                                                              std::false_type) const {
+                        montgomery_sqr_impl(result, x, std::integral_constant<std::size_t, limbs_count>());
+                    }
+
+                    //
+                    // mod_size is either std::size_t or std::integral_constant holding size of the modulus in limbs,
+                    // the carry leaving each reduction row is kept in top_carry instead of being propagated
+                    //
+                    template<typename Backend1, typename Backend2, typename SizeType>
+                    constexpr void montgomery_sqr_impl(Backend1& result, const Backend2& x,
+                                                       const SizeType mod_size) const {
+                        using default_ops::eval_lt;
+                        using default_ops::eval_subtract;
+
+                        /// input parameter should be lesser than modulus
+                        internal_limb_type t[2 * limbs_count + 1] = {0};
+                        square_limbs(t, x, mod_size);
+
+                        internal_limb_type top_carry = 0;
+                        for (std::size_t i = 0; i < mod_size; ++i) {
+                            internal_limb_type u_i = t[i] * get_p_dash();
+                            internal_limb_type k = 0;
+                            for (std::size_t j = 0; j < mod_size; ++j) {
+                                internal_double_limb_type z =
+                                    static_cast<internal_double_limb_type>(get_limb_value(get_mod().backend(), j)) *
+                                        static_cast<internal_double_limb_type>(u_i) +
+                                    t[i + j] + k;
+                                t[i + j] = static_cast<internal_limb_type>(z);
+                                k = static_cast<internal_limb_type>(z >>
+                                                                    std::numeric_limits<internal_limb_type>::digits);
+                            }
+                            internal_double_limb_type z =
+                                static_cast<internal_double_limb_type>(t[i + mod_size]) + k + top_carry;
+                            t[i + mod_size] = static_cast<internal_limb_type>(z);
+                            top_carry =
+                                static_cast<internal_limb_type>(z >> std::numeric_limits<internal_limb_type>::digits);
+                        }
+                        t[2 * mod_size] = top_carry;
+
+                        Backend_padded_limbs A(internal_limb_type(0u));
+                        for (std::size_t j = 0; j <= mod_size; ++j) {
+                            A.limbs()[j] = t[mod_size + j];
+                        }
+                        //
+                        // recover correct size of backend content
+                        //
+                        adjust_backend_size(A, mod_size);
+
+                        if (!eval_lt(A, get_mod().backend())) {
+                            eval_subtract(A, get_mod().backend());
+                        }
+                        result = A;
+                    }
+
+                    //
+                    // result = x^-1 * R^2 mod m, so the inverse of a number in Montgomery form stays in Montgomery
+                    // form, zero if x is not invertible. Bernstein-Yang divsteps are used, their count depends on the
+                    // modulus size only. Available for odd modulus and 64-bit limbs, see has_safegcd_inverse.
+                    //
+                    template<typename Backend1, typename Backend2>
+                    constexpr void montgomery_inverse(Backend1& result, const Backend2& x) const {
+                        using default_ops::eval_msb;
+
+                        constexpr std::size_t signed62_limbs_count =
+                            detail::safegcd_limbs_count(limbs_count * limb_bits);
+
+                        /// limbs above the size of backend are not guaranteed to be zero
+                        limb_type x_limbs[limbs_count] = {0}, m_limbs[limbs_count] = {0};
+                        for (std::size_t i = 0; i < limbs_count; ++i) {
+                            x_limbs[i] = get_limb_value(x, i);
+                            m_limbs[i] = get_limb_value(get_mod().backend(), i);
+                        }
+
+                        std::int64_t x62[signed62_limbs_count] = {0}, m62[signed62_limbs_count] = {0},
+                                     result62[signed62_limbs_count] = {0};
+                        safegcd_to_signed62<signed62_limbs_count, limbs_count>(x62, x_limbs);
+                        safegcd_to_signed62<signed62_limbs_count, limbs_count>(m62, m_limbs);
+
+                        /// p_dash is -m^-1 mod 2^64
+                        const std::uint64_t m_inv62 =
+                            (static_cast<std::uint64_t>(0u) - get_p_dash()) & detail::safegcd_limb_mask;
+                        safegcd_inverse<signed62_limbs_count>(
+                            result62, x62, m62, m_inv62,
+                            detail::safegcd_divsteps_count(eval_msb(get_mod().backend()) + 1u));
+
+                        limb_type result_limbs[limbs_count] = {0};
+                        safegcd_from_signed62<signed62_limbs_count, limbs_count>(result_limbs, result62);
+
+                        Backend inverse;
+                        inverse.resize(limbs_count, limbs_count);
+                        for (std::size_t i = 0; i < limbs_count; ++i) {
+                            inverse.limbs()[i] = result_limbs[i];
+                        }
+                        inverse.normalize();
+
+                        /// (x^-1 * R^2) * R^-1 twice, x = a * R gives a^-1 * R
+                        montgomery_mul(inverse, get_r2());
+                        montgomery_mul(result, inverse, get_r2());
+                    }
+
                     template<typename Backend1, typename Backend2>
                     constexpr void regular_exp(Backend1& result, const Backend2& exp) const {
                         regular_exp(result, result, exp);
@@ -583,14 +871,8 @@ namespace nil {
                              /// result should fit in the output parameter
                              typename = typename boost::enable_if_c<max_precision<Backend1>::value >=
                                                                     max_precision<Backend>::value>::type>
-                    constexpr void regular_exp(Backend1& result, Backend2& a, Backend3 exp) const {
+                    constexpr void regular_exp(Backend1& result, const Backend2& a, const Backend3& exp) const {
                         using default_ops::eval_eq;
-                        using default_ops::eval_lt;
-                        using default_ops::eval_multiply;
-
-                        // TODO: maybe reduce input parameter
-                        /// input parameter should be lesser than modulus
-                        // BOOST_ASSERT(eval_lt(a, get_mod().backend()));
 
                         if (eval_eq(exp, static_cast<internal_limb_type>(0u))) {
                             result = static_cast<internal_limb_type>(1u);
@@ -601,22 +883,10 @@ namespace nil {
                             return;
                         }
 
-                        Backend_doubled_limbs base(a), res(static_cast<internal_limb_type>(1u));
-
-                        while (true) {
-                            internal_limb_type lsb = exp.limbs()[0] & 1u;
-                            custom_right_shift(exp, static_cast<internal_limb_type>(1u));
-                            if (lsb) {
-                                eval_multiply(res, base);
-                                barrett_reduce(res);
-                                if (eval_eq(exp, static_cast<internal_limb_type>(0u))) {
-                                    break;
-                                }
-                            }
-                            eval_multiply(base, base);
-                            barrett_reduce(base);
-                        }
-                        result = res;
+                        Backend base;
+                        barrett_reduce(base, a);
+                        sliding_window_exp(result, base, exp, Backend(static_cast<internal_limb_type>(1u)),
+                                           std::false_type());
                     }
 
                     template<typename Backend1, typename Backend2>
@@ -628,30 +898,15 @@ namespace nil {
                              /// result should fit in the output parameter
                              typename = typename boost::enable_if_c<max_precision<Backend1>::value >=
                                                                     max_precision<Backend>::value>::type>
-                    constexpr void montgomery_exp(Backend1& result, const Backend2& a, Backend3 exp) const {
+                    constexpr void montgomery_exp(Backend1& result, const Backend2& a, const Backend3& exp) const {
                         using default_ops::eval_eq;
-                        using default_ops::eval_lt;
-                        using default_ops::eval_multiply;
 
                         // TODO: maybe reduce input parameter
                         /// input parameter should be lesser than modulus
                         // BOOST_ASSERT(eval_lt(a, get_mod().backend()));
 
-                        Backend_doubled_limbs tmp(static_cast<internal_limb_type>(1u));
-                        eval_multiply(tmp, get_r2());
-                        montgomery_reduce(tmp);
-                        Backend R_mod_m(tmp);
-
-                        Backend base(a);
-
                         if (eval_eq(exp, static_cast<internal_limb_type>(0u))) {
-                            result = static_cast<internal_limb_type>(1u);
-                            //
-                            // TODO: restructure code
-                            // adjust_modular
-                            //
-                            eval_multiply(result, get_r2());
-                            montgomery_reduce(result);
+                            result = montgomery_one();
                             return;
                         }
                         if (eval_eq(get_mod().backend(), static_cast<internal_limb_type>(1u))) {
@@ -659,18 +914,57 @@ namespace nil {
                             return;
                         }
 
-                        while (true) {
-                            internal_limb_type lsb = exp.limbs()[0] & 1u;
-                            custom_right_shift(exp, static_cast<internal_limb_type>(1u));
-                            if (lsb) {
-                                montgomery_mul(R_mod_m, base);
-                                if (eval_eq(exp, static_cast<internal_limb_type>(0u))) {
-                                    break;
-                                }
-                            }
-                            montgomery_mul(base, base);
+                        sliding_window_exp(result, Backend(a), exp, montgomery_one(), std::true_type());
+                    }
+
+                    //
+                    // fixed window versions perform the same sequence of squarings and multiplications
+                    // for all the exponents of the same type and select precomputed powers by scanning
+                    // the whole table, so neither branches nor memory access pattern depend on exponent bits
+                    //
+                    template<typename Backend1, typename Backend2>
+                    constexpr void regular_exp_fixed_window(Backend1& result, const Backend2& exp) const {
+                        regular_exp_fixed_window(result, result, exp);
+                    }
+
+                    template<typename Backend1, typename Backend2, typename Backend3,
+                             /// result should fit in the output parameter
+                             typename = typename boost::enable_if_c<max_precision<Backend1>::value >=
+                                                                    max_precision<Backend>::value>::type>
+                    constexpr void regular_exp_fixed_window(Backend1& result, const Backend2& a,
+                                                            const Backend3& exp) const {
+                        using default_ops::eval_eq;
+
+                        if (eval_eq(get_mod().backend(), static_cast<internal_limb_type>(1u))) {
+                            result = static_cast<internal_limb_type>(0u);
+                            return;
+                        }
+
+                        Backend base;
+                        barrett_reduce(base, a);
+                        fixed_window_exp(result, base, exp, Backend(static_cast<internal_limb_type>(1u)),
+                                         std::false_type());
+                    }
+
+                    template<typename Backend1, typename Backend2>
+                    constexpr void montgomery_exp_fixed_window(Backend1& result, const Backend2& exp) const {
+                        montgomery_exp_fixed_window(result, result, exp);
+                    }
+
+                    template<typename Backend1, typename Backend2, typename Backend3,
+                             /// result should fit in the output parameter
+                             typename = typename boost::enable_if_c<max_precision<Backend1>::value >=
+                                                                    max_precision<Backend>::value>::type>
+                    constexpr void montgomery_exp_fixed_window(Backend1& result, const Backend2& a,
+                                                               const Backend3& exp) const {
+                        using default_ops::eval_eq;
+
+                        if (eval_eq(get_mod().backend(), static_cast<internal_limb_type>(1u))) {
+                            result = static_cast<internal_limb_type>(0u);
+                            return;
                         }
-                        result = R_mod_m;
+
+                        fixed_window_exp(result, Backend(a), exp, montgomery_one(), std::true_type());
                     }
 
                     constexpr void swap(modular_functions_fixed& o) {
@@ -699,6 +993,173 @@ namespace nil {
                     }
 
                 protected:
+                    constexpr static std::size_t fixed_exp_window_bits = 4u;
+
+                    /// 1 in Montgomery form, i.e. R mod m
+                    constexpr Backend montgomery_one() const {
+                        using default_ops::eval_multiply;
+
+                        Backend_doubled_limbs tmp(static_cast<internal_limb_type>(1u));
+                        eval_multiply(tmp, get_r2());
+                        montgomery_reduce(tmp);
+                        return Backend(tmp);
+                    }
+
+                    template<typename Backend1>
+                    constexpr void exp_mul(Backend1& result, const Backend& x, std::true_type) const {
+                        montgomery_mul(result, result, x);
+                    }
+
+                    template<typename Backend1>
+                    constexpr void exp_mul(Backend1& result, const Backend& x, std::false_type) const {
+                        regular_mul(result, result, x);
+                    }
+
+                    template<typename Backend1>
+                    constexpr void exp_sqr(Backend1& result, std::true_type) const {
+                        montgomery_sqr(result);
+                    }
+
+                    template<typename Backend1>
+                    constexpr void exp_sqr(Backend1& result, std::false_type) const {
+                        regular_sqr(result);
+                    }
+
+                    //
+                    // accumulator operations of sliding_window_exp in the domain defined by IsMontgomery
+                    //
+                    template<typename Backend1, bool IsMontgomery>
+                    struct sliding_window_operations {
+                        constexpr void assign(std::size_t k) {
+                            acc = table[k];
+                        }
+
+                        constexpr void square() {
+                            functions.exp_sqr(acc, std::integral_constant<bool, IsMontgomery>());
+                        }
+
+                        constexpr void multiply(std::size_t k) {
+                            functions.exp_mul(acc, table[k], std::integral_constant<bool, IsMontgomery>());
+                        }
+
+                        const modular_functions_fixed& functions;
+                        const Backend* table;
+                        Backend1& acc;
+                    };
+
+                    //
+                    // left-to-right sliding window exponentiation, table of odd powers of base is kept on the stack,
+                    // one is the unit of the domain defined by IsMontgomery, exp should be positive
+                    //
+                    template<typename Backend1, typename Backend2, bool IsMontgomery>
+                    constexpr void sliding_window_exp(Backend1& result, const Backend& base, const Backend2& exp,
+                                                      const Backend& one,
+                                                      std::integral_constant<bool, IsMontgomery> domain) const {
+                        using default_ops::eval_msb;
+
+                        const std::size_t window_bits = nil::crypto3::multiprecision::detail::sliding_window_bits(
+                            static_cast<std::size_t>(eval_msb(exp)) + 1u);
+
+                        /// table[k] = base^(2k + 1)
+                        constexpr std::size_t table_size =
+                            std::size_t(1u) << (nil::crypto3::multiprecision::detail::max_sliding_window_bits - 1u);
+                        Backend table[table_size];
+                        table[0] = base;
+                        if (window_bits > 1u) {
+                            Backend base_sqr(base);
+                            exp_sqr(base_sqr, domain);
+                            for (std::size_t k = 1; k < (std::size_t(1u) << (window_bits - 1u)); ++k) {
+                                table[k] = table[k - 1];
+                                exp_mul(table[k], base_sqr, domain);
+                            }
+                        }
+
+                        Backend acc(one);
+                        sliding_window_operations<Backend, IsMontgomery> operations {*this, table, acc};
+                        nil::crypto3::multiprecision::detail::sliding_window_exp(exp, window_bits, operations);
+                        result = acc;
+                    }
+
+                    //
+                    // the exponent is processed by fixed_exp_window_bits windows, the count of which is defined
+                    // by the exponent type for fixed precision exponents and by the exponent length otherwise
+                    //
+                    template<typename Backend1, typename Backend2, bool IsMontgomery>
+                    constexpr void fixed_window_exp(Backend1& result, const Backend& base, const Backend2& exp,
+                                                    const Backend& one,
+                                                    std::integral_constant<bool, IsMontgomery> domain) const {
+                        using default_ops::eval_bit_test;
+                        using default_ops::eval_eq;
+                        using default_ops::eval_msb;
+
+                        std::size_t exp_bits = 1u;
+                        if (is_fixed_precision<Backend2>::value) {
+                            exp_bits = max_precision<Backend2>::value;
+                        } else if (!eval_eq(exp, static_cast<internal_limb_type>(0u))) {
+                            exp_bits = eval_msb(exp) + 1u;
+                        }
+                        const std::size_t windows_count =
+                            (exp_bits + fixed_exp_window_bits - 1u) / fixed_exp_window_bits;
+
+                        /// table[k] = base^k
+                        Backend table[std::size_t(1u) << fixed_exp_window_bits];
+                        table[0] = one;
+                        table[1] = base;
+                        for (std::size_t k = 2; k < (std::size_t(1u) << fixed_exp_window_bits); ++k) {
+                            table[k] = table[k - 1];
+                            exp_mul(table[k], base, domain);
+                        }
+
+                        Backend acc(one), power;
+                        for (std::size_t i = windows_count; i > 0; --i) {
+                            std::size_t window_value = 0;
+                            for (std::size_t j = fixed_exp_window_bits; j > 0; --j) {
+                                exp_sqr(acc, domain);
+                                window_value = (window_value << 1u) |
+                                               (eval_bit_test(exp, static_cast<unsigned>(
+                                                                       (i - 1u) * fixed_exp_window_bits + j - 1u))
+                                                    ? 1u
+                                                    : 0u);
+                            }
+                            select_table_entry(power, table, std::size_t(1u) << fixed_exp_window_bits, window_value,
+                                               std::integral_constant<bool, is_trivial_cpp_int<Backend>::value>());
+                            exp_mul(acc, power, domain);
+                        }
+                        result = acc;
+                    }
+
+                    constexpr void select_table_entry(Backend& result, const Backend* table, std::size_t count,
+                                                      std::size_t index, std::false_type) const {
+                        internal_limb_type limbs[limbs_count] = {0};
+                        for (std::size_t k = 0; k < count; ++k) {
+                            const internal_limb_type mask =
+                                static_cast<internal_limb_type>(0u) - static_cast<internal_limb_type>(k == index);
+                            for (std::size_t j = 0; j < limbs_count; ++j) {
+                                limbs[j] |= get_limb_value(table[k], j) & mask;
+                            }
+                        }
+
+                        result.resize(limbs_count, limbs_count);
+                        for (std::size_t j = 0; j < limbs_count; ++j) {
+                            result.limbs()[j] = limbs[j];
+                        }
+                        result.sign(false);
+                        result.normalize();
+                    }
+
+                    constexpr void select_table_entry(Backend& result, const Backend* table, std::size_t count,
+                                                      std::size_t index, std::true_type) const {
+                        internal_limb_type value = 0;
+                        for (std::size_t k = 0; k < count; ++k) {
+                            const internal_limb_type mask =
+                                static_cast<internal_limb_type>(0u) - static_cast<internal_limb_type>(k == index);
+                            value |= *table[k].limbs() & mask;
+                        }
+
+                        result = table[0];
+                        *result.limbs() = value;
+                    }
+
                     // TODO: replace number_type on backend type
                     number_type m_mod;
                     Backend_doubled_1 m_barrett_mu;
@@ -11,6 +11,7 @@
 #define BOOST_MULTIPRECISION_MODULAR_PARAMS_FIXED_PRECISION_HPP
 
 #include <nil/crypto3/multiprecision/modular/modular_functions_fixed.hpp>
+#include <nil/crypto3/multiprecision/modular/inverse.hpp>
 
 namespace nil {
     namespace crypto3 {
@@ -30,6 +31,7 @@ namespace nil {
 
             protected:
                 typedef typename policy_type::internal_limb_type internal_limb_type;
+                typedef typename policy_type::Backend_padded_limbs Backend_padded_limbs;
                 typedef typename policy_type::Backend_doubled_limbs Backend_doubled_limbs;
                 typedef typename policy_type::number_type number_type;
                 typedef typename policy_type::number_type_u number_type_u;
@@ -70,13 +72,13 @@ namespace nil {
 
                 template<typename Backend1>
                 constexpr typename boost::enable_if_c<boost::is_same<Backend1, Backend>::value>::type
-                    adjust_modular(Backend1& result) {
+                    adjust_modular(Backend1& result) const {
                     adjust_modular(result, result);
                 }
 
                 template<typename Backend1, typename Backend2>
                 constexpr typename boost::enable_if_c<boost::is_same<Backend1, Backend>::value>::type
-                    adjust_modular(Backend1& result, Backend2 input) {
+                    adjust_modular(Backend1& result, Backend2 input) const {
                     Backend_doubled_limbs tmp;
                     get_mod_obj().barrett_reduce(tmp, input);
                     if (check_montgomery_constraints(get_mod_obj())) {
@@ -117,13 +119,27 @@ namespace nil {
                     }
                 }
 
+                template<typename Backend1, typename T>
+                constexpr void mod_exp_fixed_window(Backend1& result, const T& exp) const {
+                    mod_exp_fixed_window(result, result, exp);
+                }
+
+                template<typename Backend1, typename Backend2, typename T>
+                constexpr void mod_exp_fixed_window(Backend1& result, const Backend2& a, const T& exp) const {
+                    if (check_montgomery_constraints(get_mod_obj())) {
+                        get_mod_obj().montgomery_exp_fixed_window(result, a, exp);
+                    } else {
+                        get_mod_obj().regular_exp_fixed_window(result, a, exp);
+                    }
+                }
+
                 template<typename Backend1, typename Backend2>
-                constexpr void mod_mul(Backend1& result, const Backend2& y) {
+                constexpr void mod_mul(Backend1& result, const Backend2& y) const {
                     mod_mul(result, result, y);
                 }
 
                 template<typename Backend1, typename Backend2, typename Backend3>
-                constexpr void mod_mul(Backend1& result, const Backend2& x, const Backend3& y) {
+                constexpr void mod_mul(Backend1& result, const Backend2& x, const Backend3& y) const {
                     if (check_montgomery_constraints(get_mod_obj())) {
                         get_mod_obj().montgomery_mul(result, x, y);
                     } else {
@@ -131,13 +147,41 @@ namespace nil {
                     }
                 }
 
+                template<typename Backend1>
+                constexpr void mod_sqr(Backend1& result) const {
+                    mod_sqr(result, result);
+                }
+
+                template<typename Backend1, typename Backend2>
+                constexpr void mod_sqr(Backend1& result, const Backend2& x) const {
+                    if (check_montgomery_constraints(get_mod_obj())) {
+                        get_mod_obj().montgomery_sqr(result, x);
+                    } else {
+                        get_mod_obj().regular_sqr(result, x);
+                    }
+                }
+
+                //
+                // inverse of x in the modular form, zero if x is not invertible. Numbers modulo odd m are inverted
+                // by constant-time safegcd divsteps when limbs are 64-bit, by extended Euclidean algorithm otherwise.
+                //
+                template<typename Backend1, typename Backend2>
+                constexpr void mod_inverse(Backend1& result, const Backend2& x) const {
+                    typedef std::integral_constant<bool,
+                                                   backends::has_safegcd_inverse<policy_type::limb_bits>::value &&
+                                                       !backends::is_trivial_cpp_int<Backend>::value>
+                        safegcd_tag;
+
+                    mod_inverse_impl(result, x, safegcd_tag());
+                }
+
                 template<typename Backend1, typename Backend2>
-                constexpr void mod_add(Backend1& result, const Backend2& y) {
+                constexpr void mod_add(Backend1& result, const Backend2& y) const {
                     mod_add(result, result, y);
                 }
 
                 template<typename Backend1, typename Backend2, typename Backend3>
-                constexpr void mod_add(Backend1& result, const Backend2& x, const Backend3& y) {
+                constexpr void mod_add(Backend1& result, const Backend2& x, const Backend3& y) const {
                     get_mod_obj().regular_add(result, x, y);
                 }
 
@@ -175,9 +219,97 @@ namespace nil {
                 }
 
             protected:
+                template<typename Backend1, typename Backend2>
+                constexpr void mod_inverse_impl(Backend1& result, const Backend2& x, std::true_type) const {
+                    if (check_montgomery_constraints(get_mod_obj())) {
+                        get_mod_obj().montgomery_inverse(result, x);
+                    } else {
+                        mod_inverse_impl(result, x, std::false_type());
+                    }
+                }
+
+                template<typename Backend1, typename Backend2>
+                constexpr void mod_inverse_impl(Backend1& result, const Backend2& x, std::false_type) const {
+                    using backends::eval_inverse_mod;
+
+                    Backend_padded_limbs new_base, res, tmp = get_mod().backend();
+
+                    adjust_regular(new_base, x);
+                    eval_inverse_mod(res, new_base, tmp);
+                    adjust_modular(result, res);
+                }
+
                 modular_logic m_mod_obj;
             };
 
+            // runtime modular params shared by all the elements of
+            // modular_adaptor<modular_fixed_cpp_int_backend<...>, shared_modular_params<...>>,
+            // distinct Tag types give independent moduli of the same precision
+            template<typename Backend, typename Tag = void>
+            class shared_modular_params {
+            public:
+                typedef modular_params<Backend> modulus_type;
+
+            protected:
+                typedef typename modulus_type::policy_type::number_type number_type;
+
+            public:
+                static const modulus_type& mod_data() {
+                    return m_mod;
+                }
+
+                // not thread-safe, should be called before any element of the type is constructed
+                static void set_mod(const number_type& m) {
+                    m_mod = m;
+                }
+
+            protected:
+                static modulus_type m_mod;
+            };
+
+            template<typename Backend, typename Tag>
+            typename shared_modular_params<Backend, Tag>::modulus_type shared_modular_params<Backend, Tag>::m_mod;
+
+            namespace detail {
+                template<typename NumberType, typename Modulus, bool IsValuePack>
+                struct make_constexpr_modulus {
+                    static constexpr NumberType value = NumberType(Modulus::value);
+                };
+
+                template<typename NumberType, typename Modulus>
+                struct make_constexpr_modulus<NumberType, Modulus, true> {
+                    static constexpr NumberType value =
+                        NumberType(typename NumberType::backend_type(Modulus()));
+                };
+            }    // namespace detail
+
+            // modular params with the modulus known at compile time: Barrett and Montgomery constants are computed
+            // during compilation and the modulus limbs count is a constant for modular_functions_fixed loops.
+            // Modulus is either literals::detail::value_pack of the modulus limbs or a type with constexpr static
+            // member value, e.g. initialized with _cppui256 literal.
+            template<typename Backend, typename Modulus>
+            class constexpr_modular_params {
+            public:
+                typedef modular_params<Backend> modulus_type;
+
+            protected:
+                typedef typename modulus_type::policy_type::number_type number_type;
+
+            public:
+                static constexpr const modulus_type& mod_data() {
+                    return m_mod;
+                }
+
+            protected:
+                static constexpr modulus_type m_mod = modulus_type(
+                    detail::make_constexpr_modulus<number_type, Modulus,
+                                                   literals::detail::is_value_pack<Modulus>::value>::value);
+            };
+
+            template<typename Backend, typename Modulus>
+            constexpr typename constexpr_modular_params<Backend, Modulus>::modulus_type
+                constexpr_modular_params<Backend, Modulus>::m_mod;
+
         }    // namespace multiprecision
     }        // namespace crypto3
 }    // namespace nil
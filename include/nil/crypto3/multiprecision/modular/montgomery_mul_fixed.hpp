@@ -0,0 +1,216 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef BOOST_MULTIPRECISION_MONTGOMERY_MUL_FIXED_HPP
+#define BOOST_MULTIPRECISION_MONTGOMERY_MUL_FIXED_HPP
+
+#include <nil/crypto3/multiprecision/detail/number_base.hpp>
+#include <nil/crypto3/multiprecision/cpp_int/cpp_int_config.hpp>
+#include <nil/crypto3/multiprecision/cpp_int/intel_intrinsics.hpp>
+
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+//
+// GCC does not unroll loops at -O2 unless asked to, without unrolling the kernels are slower than the generic loop
+//
+#if defined(__clang__)
+#define BOOST_MP_MONTGOMERY_UNROLL _Pragma("unroll")
+#elif defined(__GNUC__) && (__GNUC__ >= 8)
+#define BOOST_MP_MONTGOMERY_UNROLL _Pragma("GCC unroll 16")
+#else
+#define BOOST_MP_MONTGOMERY_UNROLL
+#endif
+
+namespace nil {
+    namespace crypto3 {
+        namespace multiprecision {
+            namespace backends {
+
+                //
+                // dedicated CIOS Montgomery multiplication (and squaring) kernels for 256, 384, 512 and 768-bit moduli,
+                // inner loops have compile-time bounds and are fully unrolled
+                //
+                template<std::size_t LimbsCount>
+                struct has_montgomery_mul_kernel
+                    : public std::integral_constant<bool,
+#if defined(BOOST_HAS_INT128)
+                                                    LimbsCount == 4 || LimbsCount == 6 || LimbsCount == 8 ||
+                                                        LimbsCount == 12
+#else
+                                                    false
+#endif
+                                                    > {
+                };
+
+#if defined(BOOST_HAS_INT128)
+
+                namespace detail {
+
+                    //
+                    // t[0..N+1] += a[0..N-1] * b
+                    //
+                    template<std::size_t N>
+                    BOOST_MP_FORCEINLINE void montgomery_mul_add_row(limb_type* t, const limb_type* a, limb_type b) {
+#if defined(BOOST_MP_HAS_MULX_ADX) && defined(BOOST_MP_USE_MULX_ADX)
+                        //
+                        // low halves of the products are accumulated by adcx chain, high halves by adox chain,
+                        // opt-in only: current compilers do not keep both carry chains in flags and the
+                        // double_limb_type version (which gets mulx from -mbmi2 anyway) is usually faster
+                        //
+                        unsigned char carry_low = 0;
+                        unsigned char carry_high = 0;
+                        limb_type high, low, sum;
+                        BOOST_MP_MONTGOMERY_UNROLL
+                        for (std::size_t j = 0; j < N; ++j) {
+                            low = multiprecision::detail::mulx_limb(a[j], b, &high);
+                            carry_low = multiprecision::detail::addcarryx_limb(carry_low, t[j], low, &sum);
+                            t[j] = sum;
+                            carry_high = multiprecision::detail::addcarryx_limb(carry_high, t[j + 1], high, &sum);
+                            t[j + 1] = sum;
+                        }
+                        carry_low = multiprecision::detail::addcarryx_limb(carry_low, t[N], 0u, &sum);
+                        t[N] = sum;
+                        t[N + 1] += static_cast<limb_type>(carry_low) + static_cast<limb_type>(carry_high);
+#else
+                        double_limb_type carry = 0;
+                        BOOST_MP_MONTGOMERY_UNROLL
+                        for (std::size_t j = 0; j < N; ++j) {
+                            carry += static_cast<double_limb_type>(a[j]) * static_cast<double_limb_type>(b) + t[j];
+                            t[j] = static_cast<limb_type>(carry);
+                            carry >>= std::numeric_limits<limb_type>::digits;
+                        }
+                        carry += t[N];
+                        t[N] = static_cast<limb_type>(carry);
+                        t[N + 1] += static_cast<limb_type>(carry >> std::numeric_limits<limb_type>::digits);
+#endif
+                    }
+                }    // namespace detail
+
+                //
+                // result = x * y * R^-1 mod m, R = 2^(N * limb_bits), x and y should be lesser than m,
+                // p_dash = -m^-1 mod 2^limb_bits
+                //
+                template<std::size_t N>
+                inline typename std::enable_if<has_montgomery_mul_kernel<N>::value>::type
+                    montgomery_mul_kernel(limb_type* result, const limb_type* x, const limb_type* y,
+                                          const limb_type* m, limb_type p_dash) {
+                    limb_type t[N + 2] = {0};
+
+                    for (std::size_t i = 0; i < N; ++i) {
+                        detail::montgomery_mul_add_row<N>(t, x, y[i]);
+                        detail::montgomery_mul_add_row<N>(t, m, t[0] * p_dash);
+
+                        /// t[0] is zero now, shift accumulator one limb to the right
+                        BOOST_MP_MONTGOMERY_UNROLL
+                        for (std::size_t j = 0; j < N + 1; ++j) {
+                            t[j] = t[j + 1];
+                        }
+                        t[N + 1] = 0;
+                    }
+
+                    /// t < 2m, so a single conditional subtraction is enough
+                    limb_type reduced[N];
+                    double_limb_type borrow = 0;
+                    BOOST_MP_MONTGOMERY_UNROLL
+                    for (std::size_t j = 0; j < N; ++j) {
+                        borrow = static_cast<double_limb_type>(t[j]) - m[j] - borrow;
+                        reduced[j] = static_cast<limb_type>(borrow);
+                        borrow = (borrow >> std::numeric_limits<limb_type>::digits) & 1u;
+                    }
+                    bool use_reduced = t[N] != 0 || !borrow;
+                    BOOST_MP_MONTGOMERY_UNROLL
+                    for (std::size_t j = 0; j < N; ++j) {
+                        result[j] = use_reduced ? reduced[j] : t[j];
+                    }
+                }
+
+                //
+                // result = x^2 * R^-1 mod m, every cross product x[i] * x[j] (i < j) is computed once and doubled,
+                // the reduction carry leaving each row is kept in a single limb instead of being propagated
+                //
+                template<std::size_t N>
+                inline typename std::enable_if<has_montgomery_mul_kernel<N>::value>::type
+                    montgomery_sqr_kernel(limb_type* result, const limb_type* x, const limb_type* m,
+                                          limb_type p_dash) {
+                    limb_type t[2 * N + 1] = {0};
+                    double_limb_type carry;
+
+                    for (std::size_t i = 0; i + 1 < N; ++i) {
+                        carry = 0;
+                        BOOST_MP_MONTGOMERY_UNROLL
+                        for (std::size_t j = i + 1; j < N; ++j) {
+                            carry +=
+                                static_cast<double_limb_type>(x[i]) * static_cast<double_limb_type>(x[j]) + t[i + j];
+                            t[i + j] = static_cast<limb_type>(carry);
+                            carry >>= std::numeric_limits<limb_type>::digits;
+                        }
+                        t[i + N] = static_cast<limb_type>(carry);
+                    }
+
+                    limb_type high_bit = 0;
+                    BOOST_MP_MONTGOMERY_UNROLL
+                    for (std::size_t i = 0; i < 2 * N; ++i) {
+                        limb_type next_high_bit = t[i] >> (std::numeric_limits<limb_type>::digits - 1);
+                        t[i] = (t[i] << 1u) | high_bit;
+                        high_bit = next_high_bit;
+                    }
+
+                    carry = 0;
+                    BOOST_MP_MONTGOMERY_UNROLL
+                    for (std::size_t i = 0; i < N; ++i) {
+                        carry += static_cast<double_limb_type>(x[i]) * static_cast<double_limb_type>(x[i]) + t[2 * i];
+                        t[2 * i] = static_cast<limb_type>(carry);
+                        carry >>= std::numeric_limits<limb_type>::digits;
+                        carry += t[2 * i + 1];
+                        t[2 * i + 1] = static_cast<limb_type>(carry);
+                        carry >>= std::numeric_limits<limb_type>::digits;
+                    }
+
+                    limb_type top_carry = 0;
+                    for (std::size_t i = 0; i < N; ++i) {
+                        limb_type u = t[i] * p_dash;
+                        carry = 0;
+                        BOOST_MP_MONTGOMERY_UNROLL
+                        for (std::size_t j = 0; j < N; ++j) {
+                            carry +=
+                                static_cast<double_limb_type>(m[j]) * static_cast<double_limb_type>(u) + t[i + j];
+                            t[i + j] = static_cast<limb_type>(carry);
+                            carry >>= std::numeric_limits<limb_type>::digits;
+                        }
+                        carry += static_cast<double_limb_type>(t[i + N]) + top_carry;
+                        t[i + N] = static_cast<limb_type>(carry);
+                        top_carry = static_cast<limb_type>(carry >> std::numeric_limits<limb_type>::digits);
+                    }
+                    t[2 * N] = top_carry;
+
+                    /// t < 2m, so a single conditional subtraction is enough
+                    limb_type reduced[N];
+                    double_limb_type borrow = 0;
+                    BOOST_MP_MONTGOMERY_UNROLL
+                    for (std::size_t j = 0; j < N; ++j) {
+                        borrow = static_cast<double_limb_type>(t[N + j]) - m[j] - borrow;
+                        reduced[j] = static_cast<limb_type>(borrow);
+                        borrow = (borrow >> std::numeric_limits<limb_type>::digits) & 1u;
+                    }
+                    bool use_reduced = t[2 * N] != 0 || !borrow;
+                    BOOST_MP_MONTGOMERY_UNROLL
+                    for (std::size_t j = 0; j < N; ++j) {
+                        result[j] = use_reduced ? reduced[j] : t[N + j];
+                    }
+                }
+
+#endif
+
+            }    // namespace backends
+        }        // namespace multiprecision
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // BOOST_MULTIPRECISION_MONTGOMERY_MUL_FIXED_HPP
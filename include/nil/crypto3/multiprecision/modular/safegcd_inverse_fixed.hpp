@@ -0,0 +1,295 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef BOOST_MULTIPRECISION_SAFEGCD_INVERSE_FIXED_HPP
+#define BOOST_MULTIPRECISION_SAFEGCD_INVERSE_FIXED_HPP
+
+#include <nil/crypto3/multiprecision/detail/number_base.hpp>
+#include <nil/crypto3/multiprecision/cpp_int/cpp_int_config.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace nil {
+    namespace crypto3 {
+        namespace multiprecision {
+            namespace backends {
+
+                //
+                // Modular inversion by Bernstein-Yang divsteps, "Fast constant-time gcd computation and modular
+                // inversion" (https://gcd.cr.yp.to/safegcd-20190413.pdf). Numbers are kept in signed62 form:
+                // little-endian limbs of 62 bits, all of them but the top one are non-negative and the top one
+                // carries the sign. Divsteps are processed by batches of 62 on the lowest limbs only, the batch
+                // transition matrix is applied to the whole numbers afterwards. The number of batches depends
+                // on the modulus size only and there are no branches on secret data.
+                //
+                template<std::size_t LimbBits>
+                struct has_safegcd_inverse : public std::integral_constant<bool,
+#if defined(BOOST_HAS_INT128)
+                                                                           LimbBits == 64
+#else
+                                                                           false
+#endif
+                                                                           > {
+                };
+
+#if defined(BOOST_HAS_INT128)
+
+                namespace detail {
+
+                    constexpr std::size_t safegcd_limb_bits = 62u;
+                    constexpr std::uint64_t safegcd_limb_mask = UINT64_MAX >> 2u;
+
+                    /// count of signed62 limbs enough for the values in (-2m, m) for m < 2^Bits
+                    constexpr std::size_t safegcd_limbs_count(std::size_t bits) {
+                        return (bits + 2u + safegcd_limb_bits - 1u) / safegcd_limb_bits;
+                    }
+
+                    //
+                    // divsteps count which is enough to reach g = 0 for any f, g < 2^bits (theorem 11.2 of the paper)
+                    //
+                    constexpr std::size_t safegcd_divsteps_count(std::size_t bits) {
+                        return bits < 46u ? (49u * bits + 80u) / 17u : (49u * bits + 57u) / 17u;
+                    }
+
+                    struct safegcd_transition_matrix {
+                        std::int64_t u, v, q, r;
+                    };
+
+                    //
+                    // performs 62 divsteps on the lowest limbs of f and g, eta is -delta,
+                    // transition matrix is scaled by 2^62:  2^62 * [f', g'] = [[u, v], [q, r]] * [f, g]
+                    //
+                    constexpr std::int64_t safegcd_divsteps_62(std::int64_t eta, std::uint64_t f0, std::uint64_t g0,
+                                                               safegcd_transition_matrix& t) {
+                        /// matrix entries are in [-2^62, 2^62] but are kept unsigned to make left shifts defined
+                        std::uint64_t u = 1, v = 0, q = 0, r = 1;
+                        std::uint64_t f = f0, g = g0;
+
+                        for (std::size_t i = 0; i < safegcd_limb_bits; ++i) {
+                            /// masks for delta > 0 and for odd g
+                            std::uint64_t c1 = static_cast<std::uint64_t>(eta >> 63);
+                            const std::uint64_t c2 = static_cast<std::uint64_t>(0u) - (g & 1u);
+
+                            /// g += (delta > 0 ? -f : f) for odd g
+                            const std::uint64_t x = (f ^ c1) - c1;
+                            const std::uint64_t y = (u ^ c1) - c1;
+                            const std::uint64_t z = (v ^ c1) - c1;
+                            g += x & c2;
+                            q += y & c2;
+                            r += z & c2;
+
+                            /// delta > 0 and odd g: delta = 1 - delta and f = old g, otherwise delta = 1 + delta
+                            c1 &= c2;
+                            eta = (eta ^ static_cast<std::int64_t>(c1)) - 1 - static_cast<std::int64_t>(c1);
+                            f += g & c1;
+                            u += q & c1;
+                            v += r & c1;
+
+                            g >>= 1u;
+                            u <<= 1u;
+                            v <<= 1u;
+                        }
+
+                        t.u = static_cast<std::int64_t>(u);
+                        t.v = static_cast<std::int64_t>(v);
+                        t.q = static_cast<std::int64_t>(q);
+                        t.r = static_cast<std::int64_t>(r);
+                        return eta;
+                    }
+
+                    //
+                    // [d, e] = (t * [d, e] + m * [md, me]) / 2^62 mod m, md and me are chosen to make the division
+                    // exact and to keep d and e in (-2m, m)
+                    //
+                    template<std::size_t N>
+                    constexpr void safegcd_update_de(std::int64_t* d, std::int64_t* e,
+                                                     const safegcd_transition_matrix& t, const std::int64_t* m,
+                                                     std::uint64_t m_inv62) {
+                        const std::int64_t sd = d[N - 1] >> 63;
+                        const std::int64_t se = e[N - 1] >> 63;
+                        std::int64_t md = (t.u & sd) + (t.v & se);
+                        std::int64_t me = (t.q & sd) + (t.r & se);
+
+                        signed_double_limb_type cd = static_cast<signed_double_limb_type>(t.u) * d[0] +
+                                                     static_cast<signed_double_limb_type>(t.v) * e[0];
+                        signed_double_limb_type ce = static_cast<signed_double_limb_type>(t.q) * d[0] +
+                                                     static_cast<signed_double_limb_type>(t.r) * e[0];
+
+                        md -= static_cast<std::int64_t>(
+                            (m_inv62 * static_cast<std::uint64_t>(cd) + static_cast<std::uint64_t>(md)) &
+                            safegcd_limb_mask);
+                        me -= static_cast<std::int64_t>(
+                            (m_inv62 * static_cast<std::uint64_t>(ce) + static_cast<std::uint64_t>(me)) &
+                            safegcd_limb_mask);
+
+                        cd += static_cast<signed_double_limb_type>(m[0]) * md;
+                        ce += static_cast<signed_double_limb_type>(m[0]) * me;
+                        cd >>= safegcd_limb_bits;
+                        ce >>= safegcd_limb_bits;
+
+                        for (std::size_t i = 1; i < N; ++i) {
+                            cd += static_cast<signed_double_limb_type>(t.u) * d[i] +
+                                  static_cast<signed_double_limb_type>(t.v) * e[i] +
+                                  static_cast<signed_double_limb_type>(m[i]) * md;
+                            ce += static_cast<signed_double_limb_type>(t.q) * d[i] +
+                                  static_cast<signed_double_limb_type>(t.r) * e[i] +
+                                  static_cast<signed_double_limb_type>(m[i]) * me;
+                            d[i - 1] = static_cast<std::int64_t>(static_cast<std::uint64_t>(cd) & safegcd_limb_mask);
+                            e[i - 1] = static_cast<std::int64_t>(static_cast<std::uint64_t>(ce) & safegcd_limb_mask);
+                            cd >>= safegcd_limb_bits;
+                            ce >>= safegcd_limb_bits;
+                        }
+                        d[N - 1] = static_cast<std::int64_t>(cd);
+                        e[N - 1] = static_cast<std::int64_t>(ce);
+                    }
+
+                    //
+                    // [f, g] = t * [f, g] / 2^62, the division is exact
+                    //
+                    template<std::size_t N>
+                    constexpr void safegcd_update_fg(std::int64_t* f, std::int64_t* g,
+                                                     const safegcd_transition_matrix& t) {
+                        signed_double_limb_type cf = static_cast<signed_double_limb_type>(t.u) * f[0] +
+                                                     static_cast<signed_double_limb_type>(t.v) * g[0];
+                        signed_double_limb_type cg = static_cast<signed_double_limb_type>(t.q) * f[0] +
+                                                     static_cast<signed_double_limb_type>(t.r) * g[0];
+                        cf >>= safegcd_limb_bits;
+                        cg >>= safegcd_limb_bits;
+
+                        for (std::size_t i = 1; i < N; ++i) {
+                            cf += static_cast<signed_double_limb_type>(t.u) * f[i] +
+                                  static_cast<signed_double_limb_type>(t.v) * g[i];
+                            cg += static_cast<signed_double_limb_type>(t.q) * f[i] +
+                                  static_cast<signed_double_limb_type>(t.r) * g[i];
+                            f[i - 1] = static_cast<std::int64_t>(static_cast<std::uint64_t>(cf) & safegcd_limb_mask);
+                            g[i - 1] = static_cast<std::int64_t>(static_cast<std::uint64_t>(cg) & safegcd_limb_mask);
+                            cf >>= safegcd_limb_bits;
+                            cg >>= safegcd_limb_bits;
+                        }
+                        f[N - 1] = static_cast<std::int64_t>(cf);
+                        g[N - 1] = static_cast<std::int64_t>(cg);
+                    }
+
+                    template<std::size_t N>
+                    constexpr void safegcd_conditional_add(std::int64_t* r, const std::int64_t* m,
+                                                           std::int64_t mask) {
+                        for (std::size_t i = 0; i < N; ++i) {
+                            r[i] += m[i] & mask;
+                        }
+                    }
+
+                    template<std::size_t N>
+                    constexpr void safegcd_propagate_carries(std::int64_t* r) {
+                        for (std::size_t i = 0; i + 1 < N; ++i) {
+                            r[i + 1] += r[i] >> safegcd_limb_bits;
+                            r[i] &= static_cast<std::int64_t>(safegcd_limb_mask);
+                        }
+                    }
+
+                    //
+                    // maps r in (-2m, m) to sign(f) * r mod m in [0, m)
+                    //
+                    template<std::size_t N>
+                    constexpr void safegcd_normalize(std::int64_t* r, std::int64_t f_sign, const std::int64_t* m) {
+                        safegcd_conditional_add<N>(r, m, r[N - 1] >> 63);
+                        const std::int64_t negate_mask = f_sign >> 63;
+                        for (std::size_t i = 0; i < N; ++i) {
+                            r[i] = (r[i] ^ negate_mask) - negate_mask;
+                        }
+                        safegcd_propagate_carries<N>(r);
+                        safegcd_conditional_add<N>(r, m, r[N - 1] >> 63);
+                        safegcd_propagate_carries<N>(r);
+                    }
+                }    // namespace detail
+
+                //
+                // conversions between little-endian limb_type arrays and signed62 form of nonnegative numbers
+                //
+                template<std::size_t N, std::size_t LimbsCount>
+                constexpr void safegcd_to_signed62(std::int64_t* result, const limb_type* a) {
+                    for (std::size_t i = 0; i < N; ++i) {
+                        const std::size_t offset = i * detail::safegcd_limb_bits;
+                        const std::size_t limb_index = offset / 64u;
+                        const std::size_t shift = offset % 64u;
+
+                        std::uint64_t value = limb_index < LimbsCount ? a[limb_index] >> shift : 0u;
+                        if (shift > 64u - detail::safegcd_limb_bits && limb_index + 1 < LimbsCount) {
+                            value |= a[limb_index + 1] << (64u - shift);
+                        }
+                        result[i] = static_cast<std::int64_t>(value & detail::safegcd_limb_mask);
+                    }
+                }
+
+                template<std::size_t N, std::size_t LimbsCount>
+                constexpr void safegcd_from_signed62(limb_type* result, const std::int64_t* a) {
+                    for (std::size_t i = 0; i < LimbsCount; ++i) {
+                        result[i] = 0;
+                    }
+                    for (std::size_t i = 0; i < N; ++i) {
+                        const std::size_t offset = i * detail::safegcd_limb_bits;
+                        const std::size_t limb_index = offset / 64u;
+                        const std::size_t shift = offset % 64u;
+                        const std::uint64_t value = static_cast<std::uint64_t>(a[i]);
+
+                        if (limb_index < LimbsCount) {
+                            result[limb_index] |= value << shift;
+                        }
+                        if (shift > 64u - detail::safegcd_limb_bits && limb_index + 1 < LimbsCount) {
+                            result[limb_index + 1] |= value >> (64u - shift);
+                        }
+                    }
+                }
+
+                //
+                // result = x^-1 mod m for odd m and x in [0, m), N is the count of signed62 limbs, m_inv62 is
+                // m^-1 mod 2^62, divsteps_count could be obtained from safegcd_divsteps_count for bits of m.
+                // Returns false and leaves zero in result if x is not invertible.
+                //
+                template<std::size_t N>
+                constexpr bool safegcd_inverse(std::int64_t* result, const std::int64_t* x, const std::int64_t* m,
+                                               std::uint64_t m_inv62, std::size_t divsteps_count) {
+                    std::int64_t d[N] = {0}, e[N] = {1}, f[N] = {0}, g[N] = {0};
+                    for (std::size_t i = 0; i < N; ++i) {
+                        f[i] = m[i];
+                        g[i] = x[i];
+                    }
+
+                    std::int64_t eta = -1;
+                    for (std::size_t i = 0; i < divsteps_count; i += detail::safegcd_limb_bits) {
+                        detail::safegcd_transition_matrix t = {0, 0, 0, 0};
+                        eta = detail::safegcd_divsteps_62(eta, static_cast<std::uint64_t>(f[0]),
+                                                          static_cast<std::uint64_t>(g[0]), t);
+                        detail::safegcd_update_de<N>(d, e, t, m, m_inv62);
+                        detail::safegcd_update_fg<N>(f, g, t);
+                    }
+
+                    /// g = 0 now and f = +-gcd(m, x), that is either 1 or -1 for invertible x
+                    const std::int64_t f_sign = f[N - 1];
+                    const std::int64_t high_limbs = f_sign & static_cast<std::int64_t>(detail::safegcd_limb_mask);
+                    bool is_invertible = (f_sign == 0 || f_sign == -1) && f[0] == (high_limbs | 1);
+                    for (std::size_t i = 1; i + 1 < N; ++i) {
+                        is_invertible = is_invertible && f[i] == high_limbs;
+                    }
+
+                    detail::safegcd_normalize<N>(d, f[N - 1], m);
+                    for (std::size_t i = 0; i < N; ++i) {
+                        result[i] = is_invertible ? d[i] : 0;
+                    }
+                    return is_invertible;
+                }
+
+#endif
+
+            }    // namespace backends
+        }        // namespace multiprecision
+    }            // namespace crypto3
+}    // namespace nil
+
+#endif    // BOOST_MULTIPRECISION_SAFEGCD_INVERSE_FIXED_HPP
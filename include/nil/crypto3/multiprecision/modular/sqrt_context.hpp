@@ -0,0 +1,257 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef BOOST_MULTIPRECISION_SQRT_CONTEXT_HPP
+#define BOOST_MULTIPRECISION_SQRT_CONTEXT_HPP
+
+#include <nil/crypto3/multiprecision/number.hpp>
+#include <nil/crypto3/multiprecision/jacobi.hpp>
+#include <nil/crypto3/multiprecision/modular/modular_adaptor.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace nil {
+    namespace crypto3 {
+        namespace multiprecision {
+
+            //
+            // Square roots modulo a fixed odd prime p. Everything depending on p only is computed once, so that
+            // a root costs about one exponentiation:
+            // p = 3 mod 4: a^((p + 1) / 4);
+            // p = 5 mod 8: Atkin's algorithm with the single exponentiation (2a)^((p - 5) / 8);
+            // p = 1 mod 8, p - 1 = q * 2^s: Tonelli-Shanks with the non-residue z found here and the powers
+            // z^(q * 2^i), i <= s, kept, so every correction step is a table lookup. Tonelli-Shanks still needs
+            // up to s^2 / 2 squarings to find the orders, for large s Cipolla's exponentiation in F_(p^2) is used.
+            //
+            template<typename Backend, typename ModularParamsHolder = void,
+                     expression_template_option ExpressionTemplates =
+                         expression_template_default<modular_adaptor<Backend, ModularParamsHolder>>::value>
+            class sqrt_context {
+            public:
+                typedef number<modular_adaptor<Backend, ModularParamsHolder>, ExpressionTemplates> modular_type;
+                typedef number<Backend> integer_type;
+
+                enum algorithm_type { three_mod_four, atkin, tonelli_shanks, cipolla };
+
+                //
+                // The context for the modulus of x, the modulus must be an odd prime
+                //
+                explicit sqrt_context(const modular_type& x) : m_one(detail::modular_one(x)), m_two_adicity(0) {
+                    m_p = x.backend().mod_data().get_mod();
+                    BOOST_ASSERT(m_p > 2u && bit_test(m_p, 0));
+
+                    const unsigned p_mod_8 = integer_modulus(m_p, 8u);
+                    if (p_mod_8 % 4u == 3u) {
+                        /// (p + 1) / 4 does not overflow for p of the maximal value of a fixed width type
+                        m_algorithm = three_mod_four;
+                        m_exp = (m_p >> 2u) + 1u;
+                    } else if (p_mod_8 == 5u) {
+                        m_algorithm = atkin;
+                        m_exp = m_p >> 3u;
+                    } else {
+                        integer_type p_minus_one = m_p - 1u;
+                        m_two_adicity = lsb(p_minus_one);
+                        const unsigned bits = msb(m_p) + 1u;
+                        if (m_two_adicity * m_two_adicity > cipolla_threshold * bits) {
+                            m_algorithm = cipolla;
+                            m_exp = (m_p >> 1u) + 1u;
+                        } else {
+                            m_algorithm = tonelli_shanks;
+                            precompute_tonelli_shanks(p_minus_one >> m_two_adicity);
+                        }
+                    }
+                }
+
+                explicit sqrt_context(const modular_params<Backend>& mod) : sqrt_context(modular_type(0u, mod)) {
+                }
+
+                algorithm_type algorithm() const {
+                    return m_algorithm;
+                }
+
+                //
+                // Sets root to a square root of a and returns true, returns false and leaves root unchanged if a is
+                // a quadratic non-residue
+                //
+                bool sqrt(const modular_type& a, modular_type& root) const {
+                    if (a.is_zero()) {
+                        root = a;
+                        return true;
+                    }
+                    if (!is_square(a)) {
+                        return false;
+                    }
+
+                    switch (m_algorithm) {
+                        case three_mod_four:
+                            root = powm(a, m_exp);
+                            break;
+                        case atkin:
+                            sqrt_atkin(a, root);
+                            break;
+                        case tonelli_shanks:
+                            sqrt_tonelli_shanks(a, root);
+                            break;
+                        case cipolla:
+                            sqrt_cipolla(a, root);
+                            break;
+                    }
+                    return true;
+                }
+
+                //
+                // The Jacobi symbol costs a fraction of an exponentiation, so the non-residues are rejected by it
+                //
+                bool is_square(const modular_type& a) const {
+                    return a.is_zero() || jacobi(a.template convert_to<integer_type>(), m_p) == 1;
+                }
+
+            protected:
+                ///  Cipolla is taken when s^2 > cipolla_threshold * log2(p)
+                constexpr static unsigned cipolla_threshold = 64;
+
+                //
+                // Montgomery forms are fully reduced, the representations of equal elements are equal
+                //
+                static bool is_equal(const modular_type& a, const modular_type& b) {
+                    using default_ops::eval_eq;
+                    return eval_eq(a.backend().base_data(), b.backend().base_data());
+                }
+
+                //
+                // b = (2a)^((p - 5) / 8) and i = 2a * b^2 is a square root of -1, then a * b * (i - 1) is a root of a
+                //
+                void sqrt_atkin(const modular_type& a, modular_type& result) const {
+                    modular_type a2 = a;
+                    a2 += a;
+                    modular_type b = powm(a2, m_exp);
+                    modular_type i = b;
+                    i *= b;
+                    i *= a2;
+                    i -= m_one;
+                    result = a;
+                    result *= b;
+                    result *= i;
+                }
+
+                //
+                // m_roots[i] = g^(2^i) for g = z^q and a non-residue z, g has the order 2^s
+                //
+                void precompute_tonelli_shanks(const integer_type& q) {
+                    m_exp = q >> 1u;
+
+                    integer_type z = 2u;
+                    modular_type z_modular = m_one;
+                    z_modular += m_one;
+                    while (true) {
+                        const int j = jacobi(z, m_p);
+                        BOOST_ASSERT(j != 0);
+                        if (j == -1) {
+                            break;
+                        }
+                        ++z;
+                        z_modular += m_one;
+                    }
+
+                    m_roots.reserve(m_two_adicity + 1u);
+                    m_roots.push_back(powm(z_modular, q));
+                    for (unsigned i = 0; i < m_two_adicity; ++i) {
+                        m_roots.push_back(m_roots.back());
+                        m_roots.back() *= m_roots.back();
+                    }
+                }
+
+                //
+                // With t = a^((q - 1) / 2), r = a * t and b = r * t = a^q, the invariant is r^2 = a * b. While b != 1
+                // its order 2^i is found by squaring and b is multiplied by g^(2^(s - i)), r by g^(2^(s - i - 1)),
+                // which decreases the order of b.
+                //
+                void sqrt_tonelli_shanks(const modular_type& a, modular_type& result) const {
+                    modular_type t = powm(a, m_exp);
+                    result = a;
+                    result *= t;
+                    modular_type b = result;
+                    b *= t;
+
+                    while (!is_equal(b, m_one)) {
+                        unsigned i = 0;
+                        t = b;
+                        do {
+                            t *= t;
+                            ++i;
+                        } while (!is_equal(t, m_one));
+
+                        result *= m_roots[m_two_adicity - i - 1];
+                        b *= m_roots[m_two_adicity - i];
+                    }
+                }
+
+                //
+                // For c with w = c^2 - a a non-residue, (c + sqrt(w))^((p + 1) / 2) in F_p(sqrt(w)) is a root of a
+                // lying in F_p. The elements x + y * sqrt(w) of F_(p^2) are kept as the pairs (x, y).
+                //
+                void sqrt_cipolla(const modular_type& a, modular_type& result) const {
+                    modular_type c = m_one, w = m_one;
+                    w -= a;
+                    while (true) {
+                        if (w.is_zero()) {
+                            /// a = c^2
+                            result = c;
+                            return;
+                        }
+                        const int j = jacobi(w.template convert_to<integer_type>(), m_p);
+                        if (j == -1) {
+                            break;
+                        }
+                        /// (c + 1)^2 - a = c^2 - a + 2c + 1
+                        w += c;
+                        w += c;
+                        w += m_one;
+                        c += m_one;
+                    }
+
+                    modular_type x = c, y = m_one, u, v;
+                    for (unsigned i = msb(m_exp); i-- > 0;) {
+                        /// (x + y sqrt(w))^2 = x^2 + y^2 w + 2xy sqrt(w)
+                        u = x;
+                        u *= y;
+                        x *= x;
+                        y *= y;
+                        y *= w;
+                        x += y;
+                        y = u;
+                        y += u;
+
+                        if (bit_test(m_exp, i)) {
+                            /// (x + y sqrt(w)) (c + sqrt(w)) = xc + yw + (x + yc) sqrt(w)
+                            u = y;
+                            u *= w;
+                            v = y;
+                            v *= c;
+                            y = x;
+                            y += v;
+                            x *= c;
+                            x += u;
+                        }
+                    }
+                    result = x;
+                }
+
+                modular_type m_one;
+                integer_type m_p;
+                integer_type m_exp;
+                algorithm_type m_algorithm;
+                unsigned m_two_adicity;
+                std::vector<modular_type> m_roots;
+            };
+        }    // namespace multiprecision
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // BOOST_MULTIPRECISION_SQRT_CONTEXT_HPP
@@ -0,0 +1,314 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef BOOST_MULTIPRECISION_MULTI_EXP_HPP
+#define BOOST_MULTIPRECISION_MULTI_EXP_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <nil/crypto3/multiprecision/number.hpp>
+#include <nil/crypto3/multiprecision/inverse.hpp>
+#include <nil/crypto3/multiprecision/wnaf.hpp>
+#include <nil/crypto3/multiprecision/modular/modular_adaptor.hpp>
+
+namespace nil {
+    namespace crypto3 {
+        namespace multiprecision {
+            namespace detail {
+                //
+                // exponents are accepted both as numbers and as backends
+                //
+                template<typename Backend, expression_template_option ExpressionTemplates>
+                const Backend& multi_exp_exponent_backend(const number<Backend, ExpressionTemplates>& e) {
+                    return e.backend();
+                }
+
+                template<typename Backend>
+                const Backend& multi_exp_exponent_backend(const Backend& e) {
+                    return e;
+                }
+
+                template<typename Backend>
+                std::size_t multi_exp_window_digit(const Backend& e, std::size_t first_bit, std::size_t window_bits) {
+                    using default_ops::eval_bit_test;
+
+                    std::size_t digit = 0;
+                    for (std::size_t j = 0; j < window_bits; ++j) {
+                        digit |= static_cast<std::size_t>(eval_bit_test(e, static_cast<unsigned>(first_bit + j)))
+                                 << j;
+                    }
+                    return digit;
+                }
+
+                //
+                // table[k] = base^(2k + 1) for k < table_size
+                //
+                template<typename ModularType>
+                void multi_exp_odd_powers(std::vector<ModularType>& table, const ModularType& base,
+                                          std::size_t table_size) {
+                    table.push_back(base);
+                    if (table_size > 1) {
+                        const ModularType base_sqr = base * base;
+                        for (std::size_t k = 1; k < table_size; ++k) {
+                            table.push_back(table.back() * base_sqr);
+                        }
+                    }
+                }
+
+                //
+                // Pippenger window minimizing the count of multiplications for n exponents of exp_bits bits:
+                // every window costs n multiplications into the buckets and 2 * (2^window_bits - 1) to combine them
+                //
+                inline std::size_t pippenger_window_bits(std::size_t n, std::size_t exp_bits) {
+                    std::size_t best_window_bits = 1, best_cost = 0;
+                    for (std::size_t window_bits = 1; window_bits <= 16; ++window_bits) {
+                        const std::size_t cost = (exp_bits + window_bits - 1) / window_bits *
+                                                 (n + 2u * ((std::size_t(1u) << window_bits) - 1));
+                        if (window_bits == 1 || cost < best_cost) {
+                            best_window_bits = window_bits;
+                            best_cost = cost;
+                        }
+                    }
+                    return best_window_bits;
+                }
+            }    // namespace detail
+
+            /// wNAF width of multi_exp_straus, odd digits are in (-2^4, 2^4)
+            constexpr std::size_t multi_exp_straus_window_bits = 4;
+
+            /// multi_exp switches from interleaved wNAF to Pippenger buckets starting with this count of bases
+            constexpr std::size_t multi_exp_pippenger_threshold = 16;
+
+            //
+            // Interleaved wNAF (Straus-Shamir) multi-exponentiation: the product of bases[i]^exps[i] over a
+            // single chain of squarings. Each base gets a table of its odd powers up to 2^window_bits - 1
+            // and, when some wNAF digit is negative, of odd powers of its inverse. The bases are inverted together
+            // by batch_inverse_mod, or one by one when some of them have no inverse; only those fall back to
+            // binary digits.
+            // Exponents should be nonnegative, the range should not be empty. Exponents are copied, so exps_first
+            // may yield temporaries.
+            //
+            template<typename BaseIterator, typename ExpIterator>
+            typename std::iterator_traits<BaseIterator>::value_type
+                multi_exp_straus(BaseIterator bases_first, BaseIterator bases_last, ExpIterator exps_first,
+                                 std::size_t window_bits = multi_exp_straus_window_bits) {
+                typedef typename std::iterator_traits<BaseIterator>::value_type modular_type;
+                typedef typename std::iterator_traits<ExpIterator>::value_type exponent_type;
+                typedef typename std::decay<decltype(
+                    detail::multi_exp_exponent_backend(std::declval<exponent_type>()))>::type exponent_backend_type;
+
+                using default_ops::eval_bit_test;
+                using default_ops::eval_is_zero;
+                using default_ops::eval_msb;
+
+                BOOST_ASSERT(bases_first != bases_last);
+                BOOST_ASSERT(window_bits > 0);
+
+                const std::size_t table_size = std::size_t(1u) << (window_bits - 1);
+                std::vector<modular_type> bases(bases_first, bases_last);
+
+                std::vector<exponent_backend_type> exps;
+                std::vector<std::vector<long>> wnafs;
+                exps.reserve(bases.size());
+                wnafs.reserve(bases.size());
+                std::size_t max_length = 0;
+                bool has_negative_digits = false;
+                for (std::size_t i = 0; i < bases.size(); ++i, ++exps_first) {
+                    exps.push_back(detail::multi_exp_exponent_backend(*exps_first));
+                    wnafs.push_back(eval_find_wnaf(window_bits, exps.back()));
+                    std::vector<long>& wnaf = wnafs.back();
+                    while (!wnaf.empty() && wnaf.back() == 0) {
+                        wnaf.pop_back();
+                    }
+                    for (long digit : wnaf) {
+                        has_negative_digits = has_negative_digits || digit < 0;
+                    }
+                    max_length = std::max(max_length, wnaf.size());
+                }
+
+                std::vector<modular_type> positive_table, negative_table;
+                positive_table.reserve(bases.size() * table_size);
+                for (const modular_type& base : bases) {
+                    detail::multi_exp_odd_powers(positive_table, base, table_size);
+                }
+                if (has_negative_digits) {
+                    std::vector<modular_type> inverses(bases);
+                    if (!batch_inverse_mod(inverses.begin(), inverses.end())) {
+                        for (modular_type& inverse : inverses) {
+                            inverse = inverse_mod(inverse);
+                        }
+                    }
+
+                    const modular_type one = detail::modular_one(bases.front());
+                    negative_table.reserve(bases.size() * table_size);
+                    for (std::size_t i = 0; i < bases.size(); ++i) {
+                        detail::multi_exp_odd_powers(negative_table, inverses[i], table_size);
+
+                        /// a base sharing a factor with the modulus keeps the binary digits of its exponent
+                        if (!(inverses[i] * bases[i] == one)) {
+                            wnafs[i].clear();
+                            if (!eval_is_zero(exps[i])) {
+                                const std::size_t bits = static_cast<std::size_t>(eval_msb(exps[i])) + 1;
+                                for (std::size_t bit = 0; bit < bits; ++bit) {
+                                    wnafs[i].push_back(eval_bit_test(exps[i], static_cast<unsigned>(bit)));
+                                }
+                                max_length = std::max(max_length, bits);
+                            }
+                        }
+                    }
+                }
+
+                modular_type result = detail::modular_one(bases.front());
+                bool is_one = true;
+                for (std::size_t bit = max_length; bit-- > 0;) {
+                    if (!is_one) {
+                        result *= result;
+                    }
+                    for (std::size_t i = 0; i < bases.size(); ++i) {
+                        const long digit = bit < wnafs[i].size() ? wnafs[i][bit] : 0;
+                        if (digit == 0) {
+                            continue;
+                        }
+
+                        const modular_type& factor =
+                            digit > 0 ? positive_table[i * table_size + static_cast<std::size_t>(digit - 1) / 2] :
+                                        negative_table[i * table_size + static_cast<std::size_t>(-digit - 1) / 2];
+                        if (is_one) {
+                            result = factor;
+                            is_one = false;
+                        } else {
+                            result *= factor;
+                        }
+                    }
+                }
+                return result;
+            }
+
+            //
+            // Pippenger bucket multi-exponentiation: for every window_bits-bit window of the exponents, from the
+            // most significant one, each base is multiplied into the bucket of its window digit d and the product
+            // of bucket_d^d is collected by running products of the buckets. Windows share a single chain of
+            // squarings. window_bits defaults to the one minimizing the count of multiplications. Exponents should
+            // be nonnegative, the range should not be empty. Exponents are copied, so exps_first may yield
+            // temporaries.
+            //
+            template<typename BaseIterator, typename ExpIterator>
+            typename std::iterator_traits<BaseIterator>::value_type
+                multi_exp_pippenger(BaseIterator bases_first, BaseIterator bases_last, ExpIterator exps_first,
+                                    std::size_t window_bits = 0) {
+                typedef typename std::iterator_traits<BaseIterator>::value_type modular_type;
+                typedef typename std::iterator_traits<ExpIterator>::value_type exponent_type;
+                typedef typename std::decay<decltype(
+                    detail::multi_exp_exponent_backend(std::declval<exponent_type>()))>::type exponent_backend_type;
+
+                using default_ops::eval_is_zero;
+                using default_ops::eval_msb;
+
+                BOOST_ASSERT(bases_first != bases_last);
+
+                std::vector<modular_type> bases(bases_first, bases_last);
+
+                std::vector<exponent_backend_type> exps;
+                exps.reserve(bases.size());
+                std::size_t max_bits = 0;
+                for (std::size_t i = 0; i < bases.size(); ++i, ++exps_first) {
+                    exps.push_back(detail::multi_exp_exponent_backend(*exps_first));
+                    if (!eval_is_zero(exps.back())) {
+                        max_bits = std::max(max_bits, static_cast<std::size_t>(eval_msb(exps.back())) + 1);
+                    }
+                }
+
+                if (!window_bits) {
+                    window_bits = detail::pippenger_window_bits(bases.size(), max_bits);
+                }
+
+                const std::size_t buckets_count = (std::size_t(1u) << window_bits) - 1;
+                std::vector<modular_type> buckets(buckets_count);
+                std::vector<bool> is_bucket_used(buckets_count);
+
+                modular_type result = detail::modular_one(bases.front());
+                bool is_one = true;
+                for (std::size_t window = (max_bits + window_bits - 1) / window_bits; window-- > 0;) {
+                    if (!is_one) {
+                        for (std::size_t j = 0; j < window_bits; ++j) {
+                            result *= result;
+                        }
+                    }
+
+                    std::fill(is_bucket_used.begin(), is_bucket_used.end(), false);
+                    for (std::size_t i = 0; i < bases.size(); ++i) {
+                        const std::size_t digit =
+                            detail::multi_exp_window_digit(exps[i], window * window_bits, window_bits);
+                        if (digit == 0) {
+                            continue;
+                        }
+                        if (is_bucket_used[digit - 1]) {
+                            buckets[digit - 1] *= bases[i];
+                        } else {
+                            buckets[digit - 1] = bases[i];
+                            is_bucket_used[digit - 1] = true;
+                        }
+                    }
+
+                    /// prod bucket_d^d = prod_d (prod_{k >= d} bucket_k)
+                    modular_type running_product, window_product;
+                    bool is_running_product_used = false, is_window_product_used = false;
+                    for (std::size_t d = buckets_count; d > 0; --d) {
+                        if (is_bucket_used[d - 1]) {
+                            if (is_running_product_used) {
+                                running_product *= buckets[d - 1];
+                            } else {
+                                running_product = buckets[d - 1];
+                                is_running_product_used = true;
+                            }
+                        }
+                        if (is_running_product_used) {
+                            if (is_window_product_used) {
+                                window_product *= running_product;
+                            } else {
+                                window_product = running_product;
+                                is_window_product_used = true;
+                            }
+                        }
+                    }
+
+                    if (is_window_product_used) {
+                        if (is_one) {
+                            result = window_product;
+                            is_one = false;
+                        } else {
+                            result *= window_product;
+                        }
+                    }
+                }
+                return result;
+            }
+
+            //
+            // The product of bases[i]^exps[i] for i in [0, bases_last - bases_first): interleaved wNAF for a few
+            // bases, Pippenger buckets for many of them
+            //
+            template<typename BaseIterator, typename ExpIterator>
+            typename std::iterator_traits<BaseIterator>::value_type
+                multi_exp(BaseIterator bases_first, BaseIterator bases_last, ExpIterator exps_first) {
+                if (static_cast<std::size_t>(std::distance(bases_first, bases_last)) <
+                    multi_exp_pippenger_threshold) {
+                    return multi_exp_straus(bases_first, bases_last, exps_first);
+                }
+                return multi_exp_pippenger(bases_first, bases_last, exps_first);
+            }
+        }    // namespace multiprecision
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // BOOST_MULTIPRECISION_MULTI_EXP_HPP
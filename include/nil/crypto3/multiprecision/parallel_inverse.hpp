@@ -0,0 +1,111 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef BOOST_MULTIPRECISION_PARALLEL_INVERSE_HPP
+#define BOOST_MULTIPRECISION_PARALLEL_INVERSE_HPP
+
+#include <nil/crypto3/multiprecision/inverse.hpp>
+
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+namespace nil {
+    namespace crypto3 {
+        namespace multiprecision {
+            //
+            // Splits [first, last) into threads_count chunks inverted concurrently with Montgomery's trick, which
+            // costs one inversion per chunk. Elements should not share state mutated by arithmetic. The products
+            // of all the chunks are inverted before any element is written back: like batch_inverse_mod, it
+            // returns false and leaves the range unchanged if some nonzero element is not invertible. An exception
+            // thrown while inverting a chunk is rethrown on the calling thread once all the chunks are done.
+            //
+            template<typename RandomAccessIterator>
+            bool parallel_batch_inverse_mod(RandomAccessIterator first, RandomAccessIterator last,
+                                            std::size_t threads_count = std::thread::hardware_concurrency()) {
+                typedef typename std::iterator_traits<RandomAccessIterator>::value_type modular_type;
+                typedef typename std::iterator_traits<RandomAccessIterator>::difference_type difference_type;
+
+                /// each chunk should be long enough to amortize its own inversion
+                constexpr difference_type min_chunk_size = 64;
+
+                const difference_type size = last - first;
+                if (threads_count > static_cast<std::size_t>(size / min_chunk_size)) {
+                    threads_count = static_cast<std::size_t>(size / min_chunk_size);
+                }
+                if (threads_count <= 1) {
+                    return batch_inverse_mod(first, last);
+                }
+
+                const difference_type chunks_count = static_cast<difference_type>(threads_count);
+                const difference_type chunk_size = (size + chunks_count - 1) / chunks_count;
+                std::vector<std::vector<modular_type>> prefix_products(threads_count);
+                std::vector<modular_type> inverted_products(threads_count);
+                std::vector<char> is_invertible(threads_count, 1);
+
+                /// runs step(index, chunk_first, chunk_last) on every chunk, the last one on the calling thread
+                const auto for_each_chunk = [&](const auto& step) {
+                    std::vector<std::exception_ptr> errors(threads_count);
+                    const auto run = [&](std::size_t index, RandomAccessIterator chunk_first,
+                                         RandomAccessIterator chunk_last) {
+                        try {
+                            step(index, chunk_first, chunk_last);
+                        } catch (...) {
+                            errors[index] = std::current_exception();
+                        }
+                    };
+
+                    std::vector<std::thread> workers;
+                    workers.reserve(threads_count - 1);
+                    std::size_t index = 0;
+                    RandomAccessIterator chunk_first = first;
+                    try {
+                        for (; last - chunk_first > chunk_size; chunk_first += chunk_size, ++index) {
+                            workers.emplace_back(run, index, chunk_first, chunk_first + chunk_size);
+                        }
+                        run(index, chunk_first, last);
+                    } catch (...) {
+                        /// a thread could not be started, the running ones are still joined before rethrowing
+                        errors[index] = std::current_exception();
+                    }
+
+                    for (std::thread& worker : workers) {
+                        worker.join();
+                    }
+                    for (const std::exception_ptr& error : errors) {
+                        if (error) {
+                            std::rethrow_exception(error);
+                        }
+                    }
+                };
+
+                for_each_chunk([&](std::size_t index, RandomAccessIterator chunk_first,
+                                   RandomAccessIterator chunk_last) {
+                    is_invertible[index] = detail::batch_inverse_products(chunk_first, chunk_last,
+                                                                          prefix_products[index],
+                                                                          inverted_products[index]);
+                });
+                for (char chunk_is_invertible : is_invertible) {
+                    if (!chunk_is_invertible) {
+                        return false;
+                    }
+                }
+                for_each_chunk([&](std::size_t index, RandomAccessIterator chunk_first,
+                                   RandomAccessIterator chunk_last) {
+                    detail::batch_inverse_write(chunk_first, chunk_last, prefix_products[index],
+                                                inverted_products[index]);
+                });
+                return true;
+            }
+        }    // namespace multiprecision
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // BOOST_MULTIPRECISION_PARALLEL_INVERSE_HPP
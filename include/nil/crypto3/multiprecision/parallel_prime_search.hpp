@@ -0,0 +1,180 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef BOOST_MULTIPRECISION_PARALLEL_PRIME_SEARCH_HPP
+#define BOOST_MULTIPRECISION_PARALLEL_PRIME_SEARCH_HPP
+
+#include <nil/crypto3/multiprecision/prime_generator.hpp>
+
+#include <boost/random.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <limits>
+#include <thread>
+#include <vector>
+
+namespace nil {
+    namespace crypto3 {
+        namespace multiprecision {
+            namespace detail {
+                //
+                // Miller-Rabin test of a sieve survivor: the base 2 test rejects most composites before trials
+                // random witnesses drawn from gen are tried
+                //
+                template<class I, class Engine>
+                bool is_sieved_probable_prime(const I& n, unsigned trials, Engine& gen) {
+                    bool is_prime;
+                    if (n <= 227u && is_decided_by_small_primes(n, is_prime)) {
+                        return is_prime;
+                    }
+                    miller_rabin_engine<I> engine(n);
+                    return engine.is_strong_probable_prime(I(2u)) && engine.test(trials, gen);
+                }
+
+                template<class I, class Engine>
+                bool is_sieved_probable_safe_prime(const I& p, unsigned trials, Engine& gen) {
+                    const I q = p >> 1u;
+                    if (p <= 227u || q <= 227u) {
+                        return is_sieved_probable_prime(p, trials, gen) && is_sieved_probable_prime(q, trials, gen);
+                    }
+                    miller_rabin_engine<I> engine(p);
+                    return engine.is_strong_probable_prime(I(2u)) && is_sieved_probable_prime(q, trials, gen) &&
+                           engine.test(trials, gen);
+                }
+            }    // namespace detail
+
+            //
+            // Parallel search of the first probable prime (probable safe prime if safe_prime is set) not below
+            // start. The candidates are split into blocks of block_size sieve steps, block b is searched by worker
+            // b % threads_count with the sieve of prime_generator, and every worker tests the survivors with
+            // trials Miller-Rabin rounds drawn from its own engine seeded by seed and the worker index. Once a
+            // prime is found in some block, the blocks above it are abandoned, the blocks below are completed,
+            // so the result depends on seed and threads_count only. An exception thrown by a worker stops the other
+            // ones and is rethrown on the calling thread once all of them are joined.
+            //
+            template<class I>
+            I parallel_find_prime(const I& start, std::uint64_t seed, bool safe_prime = false, unsigned trials = 25,
+                                  std::size_t threads_count = std::thread::hardware_concurrency(),
+                                  std::size_t block_size = 4096) {
+                BOOST_ASSERT(block_size > 0);
+                if (threads_count == 0) {
+                    threads_count = 1;
+                }
+
+                const unsigned step = safe_prime ? 4u : 2u;
+                const unsigned target = safe_prime ? 3u : 1u;
+                I first = start;
+                while (integer_modulus(first, step) != target) {
+                    ++first;
+                }
+                const I block_span = I(block_size) * step;
+
+                constexpr std::size_t not_found = (std::numeric_limits<std::size_t>::max)();
+                std::atomic<std::size_t> found_block(not_found);
+                std::vector<std::size_t> worker_blocks(threads_count, not_found);
+                std::vector<I> worker_primes(threads_count);
+                std::vector<std::exception_ptr> errors(threads_count);
+
+                auto search_blocks = [&](std::size_t worker) {
+                    boost::random::seed_seq seq({static_cast<std::uint32_t>(seed),
+                                                 static_cast<std::uint32_t>(seed >> 32u),
+                                                 static_cast<std::uint32_t>(worker)});
+                    boost::random::mt19937 gen(seq);
+
+                    for (std::size_t block = worker; block < found_block.load(); block += threads_count) {
+                        const I block_first = first + I(block) * block_span;
+                        const I block_last = block_first + block_span;
+                        /// the first block begins at start so that the generator yields 2 or 5 for the small starts
+                        prime_generator<I> generator(block == 0 ? start : block_first, safe_prime);
+
+                        while (block < found_block.load()) {
+                            const I& candidate = generator.next_candidate();
+                            if (candidate >= block_last) {
+                                break;
+                            }
+                            const bool is_prime = safe_prime ?
+                                                      detail::is_sieved_probable_safe_prime(candidate, trials, gen) :
+                                                      detail::is_sieved_probable_prime(candidate, trials, gen);
+                            if (is_prime) {
+                                worker_blocks[worker] = block;
+                                worker_primes[worker] = candidate;
+
+                                std::size_t current = found_block.load();
+                                while (block < current && !found_block.compare_exchange_weak(current, block)) {
+                                }
+                                return;
+                            }
+                        }
+                    }
+                };
+
+                auto search = [&](std::size_t worker) {
+                    try {
+                        search_blocks(worker);
+                    } catch (...) {
+                        errors[worker] = std::current_exception();
+                        /// no block is below 0, so the other workers stop at their next check
+                        found_block.store(0);
+                    }
+                };
+
+                std::vector<std::thread> workers;
+                workers.reserve(threads_count - 1);
+                try {
+                    for (std::size_t worker = 1; worker < threads_count; ++worker) {
+                        workers.emplace_back(search, worker);
+                    }
+                } catch (...) {
+                    /// a thread could not be started, the running ones are stopped and joined before rethrowing
+                    errors[0] = std::current_exception();
+                    found_block.store(0);
+                }
+                if (!errors[0]) {
+                    search(0);
+                }
+                for (std::thread& worker : workers) {
+                    worker.join();
+                }
+                for (const std::exception_ptr& error : errors) {
+                    if (error) {
+                        std::rethrow_exception(error);
+                    }
+                }
+
+                std::size_t best = 0;
+                for (std::size_t worker = 1; worker < threads_count; ++worker) {
+                    if (worker_blocks[worker] < worker_blocks[best]) {
+                        best = worker;
+                    }
+                }
+                return worker_primes[best];
+            }
+
+            //
+            // Parallel search of a random probable prime (probable safe prime) of Bits bits: the search starts from
+            // a value drawn from a generator seeded by seed with the two top bits set
+            //
+            template<unsigned Bits, class I>
+            I parallel_random_prime(std::uint64_t seed, bool safe_prime = false, unsigned trials = 25,
+                                    std::size_t threads_count = std::thread::hardware_concurrency()) {
+                boost::random::mt19937_64 base_gen(seed);
+                boost::random::independent_bits_engine<boost::random::mt19937_64, Bits, I> gen(base_gen);
+
+                I start = gen();
+                bit_set(start, Bits - 1);
+                bit_set(start, Bits - 2);
+                return parallel_find_prime(start, seed, safe_prime, trials, threads_count);
+            }
+        }    // namespace multiprecision
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // BOOST_MULTIPRECISION_PARALLEL_PRIME_SEARCH_HPP
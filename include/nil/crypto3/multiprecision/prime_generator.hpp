@@ -0,0 +1,169 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef BOOST_MULTIPRECISION_PRIME_GENERATOR_HPP
+#define BOOST_MULTIPRECISION_PRIME_GENERATOR_HPP
+
+#include <nil/crypto3/multiprecision/baillie_psw.hpp>
+#include <nil/crypto3/multiprecision/trial_division.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace nil {
+    namespace crypto3 {
+        namespace multiprecision {
+            //
+            // Incremental search of probable primes from a (random) start. The candidate is kept together with
+            // its residues modulo the first sieve_size odd primes: moving to the next candidate updates the
+            // residues by a small addition each, the candidate itself is only materialized for the sieve survivors,
+            // and only those reach the Baillie-PSW test.
+            //
+            // In the safe prime mode candidates p = 3 mod 4 are walked and p is sieved together with (p - 1) / 2:
+            // an odd prime l divides (p - 1) / 2 exactly when p = 1 mod l.
+            //
+            // The walk leaves out 2, the only even prime, and 5, the only safe prime not congruent to 3 modulo 4.
+            // Either comes first when the start is not above it.
+            //
+            template<class I>
+            class prime_generator {
+            public:
+                typedef I value_type;
+
+                explicit prime_generator(const I& start, bool safe_prime = false, std::size_t sieve_size = 2048) :
+                    m_table(sieve_size), m_safe_prime(safe_prime),
+                    m_step(safe_prime ? 4u : 2u), m_pending_steps(0), m_is_started(false),
+                    m_has_small_prime(safe_prime ? start <= 5u : start <= 2u) {
+                    BOOST_ASSERT(sieve_size > 0);
+
+                    if (m_has_small_prime) {
+                        m_small_prime = safe_prime ? 5u : 2u;
+                    }
+                    m_candidate = start;
+                    if (m_candidate < 3u) {
+                        m_candidate = 3u;
+                    }
+                    const unsigned target = m_safe_prime ? 3u : 1u;
+                    while (integer_modulus(m_candidate, m_step) != target) {
+                        ++m_candidate;
+                    }
+
+                    m_residues.resize(m_table.primes().size());
+                    m_table.residues(m_candidate, m_residues.data());
+                    m_step_residues.reserve(m_table.primes().size());
+                    for (std::uint32_t prime : m_table.primes()) {
+                        m_step_residues.push_back(m_step % prime);
+                    }
+                }
+
+                bool is_safe_prime_mode() const {
+                    return m_safe_prime;
+                }
+
+                //
+                // Moves to the next candidate surviving the sieve, the first call returns 2 or 5 when the start is
+                // not above it and the start itself if it survives otherwise
+                //
+                const I& next_candidate() {
+                    if (m_has_small_prime) {
+                        m_has_small_prime = false;
+                        return m_small_prime;
+                    }
+                    if (m_is_started) {
+                        advance();
+                    }
+                    m_is_started = true;
+                    while (!is_sieve_survivor()) {
+                        advance();
+                    }
+                    if (m_pending_steps) {
+                        m_candidate += I(m_pending_steps) * m_step;
+                        m_pending_steps = 0;
+                    }
+                    return m_candidate;
+                }
+
+                //
+                // The next probable prime (probable safe prime in the safe prime mode) not below the start
+                //
+                I next() {
+                    while (true) {
+                        const I& candidate = next_candidate();
+                        if (is_probable_prime(candidate)) {
+                            return candidate;
+                        }
+                    }
+                }
+
+            private:
+                void advance() {
+                    const std::vector<std::uint32_t>& primes = m_table.primes();
+                    for (std::size_t i = 0; i < primes.size(); ++i) {
+                        std::uint32_t r = m_residues[i] + m_step_residues[i];
+                        m_residues[i] = r >= primes[i] ? r - primes[i] : r;
+                    }
+                    ++m_pending_steps;
+                }
+
+                //
+                // A zero residue is the small prime itself for a small enough candidate, the check is only made
+                // in that rare case
+                //
+                bool is_sieve_survivor() {
+                    for (std::size_t i = 0; i < m_residues.size(); ++i) {
+                        const std::uint32_t r = m_residues[i];
+                        if ((r == 0 || (m_safe_prime && r == 1)) && !is_small_candidate(i)) {
+                            return false;
+                        }
+                    }
+                    return true;
+                }
+
+                bool is_small_candidate(std::size_t i) {
+                    if (m_pending_steps) {
+                        m_candidate += I(m_pending_steps) * m_step;
+                        m_pending_steps = 0;
+                    }
+                    if (m_residues[i] == 0) {
+                        return m_candidate == m_table.primes()[i];
+                    }
+                    return m_candidate == 2u * m_table.primes()[i] + 1u;
+                }
+
+                bool is_probable_prime(const I& p) const {
+                    if (p <= m_table.primes().back()) {
+                        return baillie_psw_test(p) && (!m_safe_prime || baillie_psw_test(I(p >> 1u)));
+                    }
+                    if (!m_safe_prime) {
+                        return baillie_psw_engine<I>(p).is_probable_prime();
+                    }
+
+                    /// the cheap base 2 test of p rejects most of the candidates before (p - 1) / 2 is tested
+                    baillie_psw_engine<I> engine(p);
+                    return engine.is_strong_probable_prime(I(2u)) &&
+                           baillie_psw_engine<I>(I(p >> 1u)).is_probable_prime() &&
+                           engine.is_strong_lucas_probable_prime();
+                }
+
+                trial_division_table m_table;
+                std::vector<std::uint32_t> m_residues;
+                std::vector<std::uint32_t> m_step_residues;
+                bool m_safe_prime;
+                unsigned m_step;
+                std::uint64_t m_pending_steps;
+                bool m_is_started;
+                bool m_has_small_prime;
+                I m_small_prime;
+                I m_candidate;
+            };
+        }    // namespace multiprecision
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // BOOST_MULTIPRECISION_PRIME_GENERATOR_HPP
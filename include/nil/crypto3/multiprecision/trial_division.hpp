@@ -0,0 +1,313 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#ifndef BOOST_MULTIPRECISION_TRIAL_DIVISION_HPP
+#define BOOST_MULTIPRECISION_TRIAL_DIVISION_HPP
+
+#include <nil/crypto3/multiprecision/cpp_int.hpp>
+#include <nil/crypto3/multiprecision/integer.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace nil {
+    namespace crypto3 {
+        namespace multiprecision {
+            namespace detail {
+                //
+                // The first count odd primes by the sieve of Eratosthenes, the bound is doubled until enough
+                // primes are found
+                //
+                inline std::vector<std::uint32_t> first_odd_primes(std::size_t count) {
+                    std::vector<std::uint32_t> primes;
+                    for (std::size_t bound = 1024; primes.size() < count; bound *= 2) {
+                        primes.clear();
+                        std::vector<bool> is_composite(bound, false);
+                        for (std::size_t i = 3; i < bound && primes.size() < count; i += 2) {
+                            if (is_composite[i]) {
+                                continue;
+                            }
+                            primes.push_back(static_cast<std::uint32_t>(i));
+                            for (std::size_t j = i * i; j < bound; j += 2 * i) {
+                                is_composite[j] = true;
+                            }
+                        }
+                    }
+                    return primes;
+                }
+
+                template<class I>
+                struct has_trial_division_kernel : public std::false_type { };
+
+#if defined(BOOST_HAS_INT128)
+                template<unsigned MinBits, unsigned MaxBits, cpp_integer_type SignType, cpp_int_check_type Checked,
+                         class Allocator, expression_template_option ExpressionTemplates>
+                struct has_trial_division_kernel<
+                    number<backends::cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>,
+                           ExpressionTemplates>>
+                    : public std::integral_constant<
+                          bool,
+                          sizeof(limb_type) == sizeof(std::uint64_t) &&
+                              !backends::is_trivial_cpp_int<
+                                  backends::cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>>::value> {
+                };
+#endif
+            }    // namespace detail
+
+            //
+            // Trial division by a configurable list of odd primes. The primes are packed into products of up to 64
+            // bits, and the residue of n modulo a product is found in one pass over the limbs of n: every step
+            // divides a two-limb value by an invariant normalized divisor with its precomputed reciprocal (Moller
+            // and Granlund, "Improved division by invariant integers"), which is a couple of multiplications
+            // instead of a hardware division. The divisors and reciprocals are kept in flat arrays and the passes
+            // for several products are interleaved. Divisibility by the single primes is then checked by
+            // multiplication with their inverses modulo 2^64.
+            //
+            class trial_division_table {
+            public:
+                explicit trial_division_table(std::size_t primes_count = 2048) :
+                    trial_division_table(detail::first_odd_primes(primes_count)) {
+                }
+
+                explicit trial_division_table(std::vector<std::uint32_t> primes) : m_primes(std::move(primes)) {
+                    constexpr std::uint64_t max_value = (std::numeric_limits<std::uint64_t>::max)();
+
+                    for (std::size_t i = 0; i < m_primes.size();) {
+                        std::uint64_t product = 1;
+                        m_product_first.push_back(i);
+                        while (i < m_primes.size() && product <= max_value / m_primes[i]) {
+                            product *= m_primes[i++];
+                        }
+                        m_products.push_back(product);
+                    }
+                    m_product_first.push_back(m_primes.size());
+
+                    for (std::uint32_t prime : m_primes) {
+                        BOOST_ASSERT(prime & 1u);
+
+                        /// Newton iteration for p^-1 mod 2^64, every step doubles the count of correct bits
+                        std::uint64_t inverse = prime;
+                        for (unsigned bits = 3; bits < 64; bits *= 2) {
+                            inverse *= 2u - prime * inverse;
+                        }
+                        m_inverses.push_back(inverse);
+                        m_limits.push_back(max_value / prime);
+                    }
+
+#if defined(BOOST_HAS_INT128)
+                    for (std::uint64_t product : m_products) {
+                        const unsigned shift = 63u - nil::crypto3::multiprecision::detail::find_msb(product);
+                        const std::uint64_t divisor = product << shift;
+                        m_shifts.push_back(shift);
+                        m_divisors.push_back(divisor);
+                        m_reciprocals.push_back(static_cast<std::uint64_t>(
+                            ((static_cast<unsigned __int128>(~divisor) << 64u) | max_value) / divisor));
+                    }
+#endif
+                }
+
+                const std::vector<std::uint32_t>& primes() const {
+                    return m_primes;
+                }
+
+                std::size_t products_count() const {
+                    return m_products.size();
+                }
+
+                //
+                // result[j] = |n| mod (j-th product of primes), result should hold products_count() values
+                //
+                template<class Backend, expression_template_option ExpressionTemplates>
+                void product_residues(const number<Backend, ExpressionTemplates>& n, std::uint64_t* result) const {
+                    product_residues_impl(n, result,
+                                          detail::has_trial_division_kernel<number<Backend, ExpressionTemplates>>());
+                }
+
+                //
+                // result[i] = |n| mod primes()[i], result should hold primes().size() values
+                //
+                template<class Backend, expression_template_option ExpressionTemplates>
+                void residues(const number<Backend, ExpressionTemplates>& n, std::uint32_t* result) const {
+                    std::vector<std::uint64_t> product_residues_values(m_products.size());
+                    product_residues(n, product_residues_values.data());
+                    for (std::size_t j = 0; j < m_products.size(); ++j) {
+                        for (std::size_t i = m_product_first[j]; i < m_product_first[j + 1]; ++i) {
+                            result[i] = prime_residue(product_residues_values[j], i);
+                        }
+                    }
+                }
+
+                //
+                // The first prime of the table dividing n, zero if there is none. The products are taken one at a
+                // time, so that most of the candidates, having a small factor, are rejected after the first ones.
+                //
+                template<class Backend, expression_template_option ExpressionTemplates>
+                std::uint32_t find_factor(const number<Backend, ExpressionTemplates>& n) const {
+                    return find_factor_impl(n,
+                                            detail::has_trial_division_kernel<number<Backend, ExpressionTemplates>>());
+                }
+
+            private:
+                //
+                // r mod primes()[i] by Barrett reduction with m_limits[i] = floor(2^64 / p)
+                //
+                std::uint32_t prime_residue(std::uint64_t r, std::size_t i) const {
+#if defined(BOOST_HAS_INT128)
+                    const std::uint64_t q =
+                        static_cast<std::uint64_t>((static_cast<unsigned __int128>(r) * m_limits[i]) >> 64u);
+                    std::uint64_t remainder = r - q * m_primes[i];
+                    if (remainder >= m_primes[i]) {
+                        remainder -= m_primes[i];
+                    }
+                    return static_cast<std::uint32_t>(remainder);
+#else
+                    return static_cast<std::uint32_t>(r % m_primes[i]);
+#endif
+                }
+
+                //
+                // The first prime of the j-th product dividing r = |n| mod (j-th product), zero if there is none:
+                // p divides r exactly when r * p^-1 mod 2^64 <= (2^64 - 1) / p
+                //
+                std::uint32_t find_product_factor(std::uint64_t r, std::size_t j) const {
+                    for (std::size_t i = m_product_first[j]; i < m_product_first[j + 1]; ++i) {
+                        if (r * m_inverses[i] <= m_limits[i]) {
+                            return m_primes[i];
+                        }
+                    }
+                    return 0;
+                }
+
+                template<class Number>
+                void product_residues_impl(const Number& n, std::uint64_t* result, const std::false_type&) const {
+                    const Number magnitude = abs(n);
+                    for (std::size_t j = 0; j < m_products.size(); ++j) {
+                        result[j] = integer_modulus(magnitude, m_products[j]);
+                    }
+                }
+
+                template<class Number>
+                std::uint32_t find_factor_impl(const Number& n, const std::false_type&) const {
+                    const Number magnitude = abs(n);
+                    for (std::size_t j = 0; j < m_products.size(); ++j) {
+                        if (std::uint32_t factor = find_product_factor(integer_modulus(magnitude, m_products[j]), j)) {
+                            return factor;
+                        }
+                    }
+                    return 0;
+                }
+
+#if defined(BOOST_HAS_INT128)
+                template<class Number>
+                void product_residues_impl(const Number& n, std::uint64_t* result, const std::true_type&) const {
+                    const limb_type* limbs = n.backend().limbs();
+                    const std::size_t size = n.backend().size();
+                    std::size_t j = 0;
+                    for (; j + lanes_count <= m_products.size(); j += lanes_count) {
+                        product_residues_lanes(limbs, size, j, result + j);
+                    }
+                    for (; j < m_products.size(); ++j) {
+                        result[j] = product_residue(limbs, size, j);
+                    }
+                }
+
+                template<class Number>
+                std::uint32_t find_factor_impl(const Number& n, const std::true_type&) const {
+                    const limb_type* limbs = n.backend().limbs();
+                    const std::size_t size = n.backend().size();
+                    for (std::size_t j = 0; j < m_products.size(); ++j) {
+                        if (std::uint32_t factor = find_product_factor(product_residue(limbs, size, j), j)) {
+                            return factor;
+                        }
+                    }
+                    return 0;
+                }
+
+                //
+                // The magnitude given by limbs modulo the j-th product: the limbs are shifted on the fly by the
+                // normalization shift of the product, x >> 1 >> (63 - shift) is x >> (64 - shift) defined for
+                // zero shift as well. The top limb of the shifted value is lesser than the normalized divisor.
+                //
+                std::uint64_t product_residue(const limb_type* limbs, std::size_t size, std::size_t j) const {
+                    const unsigned shift = m_shifts[j];
+                    const std::uint64_t d = m_divisors[j], v = m_reciprocals[j];
+
+                    std::uint64_t r = (limbs[size - 1] >> 1u) >> (63u - shift);
+                    for (std::size_t i = size - 1; i > 0; --i) {
+                        r = remainder_preinv(r, (limbs[i] << shift) | ((limbs[i - 1] >> 1u) >> (63u - shift)), d, v);
+                    }
+                    r = remainder_preinv(r, limbs[0] << shift, d, v);
+                    return r >> shift;
+                }
+
+                //
+                // product_residue for the products j, ..., j + lanes_count - 1 at once: a single residue is a chain
+                // of dependent multiplications, the chains of several products are interleaved to hide their latency
+                //
+                static constexpr std::size_t lanes_count = 4;
+
+                void product_residues_lanes(const limb_type* limbs, std::size_t size, std::size_t j,
+                                            std::uint64_t* result) const {
+                    unsigned shift[lanes_count];
+                    std::uint64_t d[lanes_count], v[lanes_count], r[lanes_count];
+                    for (std::size_t k = 0; k < lanes_count; ++k) {
+                        shift[k] = m_shifts[j + k];
+                        d[k] = m_divisors[j + k];
+                        v[k] = m_reciprocals[j + k];
+                        r[k] = (limbs[size - 1] >> 1u) >> (63u - shift[k]);
+                    }
+                    for (std::size_t i = size - 1; i > 0; --i) {
+                        for (std::size_t k = 0; k < lanes_count; ++k) {
+                            const std::uint64_t u0 =
+                                (limbs[i] << shift[k]) | ((limbs[i - 1] >> 1u) >> (63u - shift[k]));
+                            r[k] = remainder_preinv(r[k], u0, d[k], v[k]);
+                        }
+                    }
+                    for (std::size_t k = 0; k < lanes_count; ++k) {
+                        result[k] = remainder_preinv(r[k], limbs[0] << shift[k], d[k], v[k]) >> shift[k];
+                    }
+                }
+
+                //
+                // (u1 * 2^64 + u0) mod d for normalized d and u1 < d with v = floor((2^128 - 1) / d) - 2^64
+                //
+                static std::uint64_t remainder_preinv(std::uint64_t u1, std::uint64_t u0, std::uint64_t d,
+                                                      std::uint64_t v) {
+                    const unsigned __int128 q =
+                        static_cast<unsigned __int128>(v) * u1 + ((static_cast<unsigned __int128>(u1) << 64u) | u0);
+                    const std::uint64_t q1 = static_cast<std::uint64_t>(q >> 64u) + 1u;
+                    const std::uint64_t q0 = static_cast<std::uint64_t>(q);
+                    std::uint64_t r = u0 - q1 * d;
+                    /// the first correction is unpredictable and taken by a mask, the second one is rare
+                    r += d & (std::uint64_t(0) - static_cast<std::uint64_t>(r > q0));
+                    if (BOOST_UNLIKELY(r >= d)) {
+                        r -= d;
+                    }
+                    return r;
+                }
+
+                std::vector<unsigned> m_shifts;
+                std::vector<std::uint64_t> m_divisors;
+                std::vector<std::uint64_t> m_reciprocals;
+#endif
+
+                std::vector<std::uint32_t> m_primes;
+                std::vector<std::uint64_t> m_inverses;
+                std::vector<std::uint64_t> m_limits;
+                std::vector<std::uint64_t> m_products;
+                std::vector<std::size_t> m_product_first;
+            };
+        }    // namespace multiprecision
+    }        // namespace crypto3
+}    // namespace nil
+
+#endif    // BOOST_MULTIPRECISION_TRIAL_DIVISION_HPP
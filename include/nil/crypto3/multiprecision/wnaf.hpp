@@ -9,55 +9,155 @@
 #ifndef BOOST_MULTIPRECISION_WNAF_HPP
 #define BOOST_MULTIPRECISION_WNAF_HPP
 
+#include <array>
+#include <climits>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
 #include <nil/crypto3/multiprecision/number.hpp>
 
 namespace nil {
     namespace crypto3 {
         namespace multiprecision {
+            /// count of wNAF digits of a scalar of bits bits, the last one takes the carry out of the top bit
+            constexpr std::size_t wnaf_length(std::size_t bits) {
+                return bits + 1;
+            }
 
-            template<typename Backend>
-            std::vector<long> eval_find_wnaf(const size_t window_size, const Backend& scalar) {
-                using ui_type = typename std::tuple_element<0, typename Backend::unsigned_types>::type;
+            /// count of signed fixed-window digits of a scalar of bits bits, including the final carry digit
+            constexpr std::size_t fixed_window_length(std::size_t bits, std::size_t window_size) {
+                return (bits + window_size - 1) / window_size + 1;
+            }
 
-                using default_ops::eval_add;
-                using default_ops::eval_right_shift;
-                using default_ops::eval_subtract;
+            namespace detail {
+                template<typename Backend>
+                using wnaf_limb_type = typename std::remove_cv<
+                    typename std::remove_pointer<decltype(std::declval<const Backend&>().limbs())>::type>::type;
 
-                const std::size_t length = scalar.size() * std::numeric_limits<ui_type>::digits;    // upper bound
-                std::vector<long> res(length + 1);
+                //
+                // count bits of scalar starting at bit, count should not exceed the limb size
+                //
+                template<typename Backend>
+                constexpr std::size_t wnaf_get_bits(const Backend& scalar, std::size_t bit, std::size_t count) {
+                    typedef wnaf_limb_type<Backend> limb_type;
+                    constexpr std::size_t limb_bits = sizeof(limb_type) * CHAR_BIT;
 
-                Backend c(scalar);
-                ui_type j = 0;
+                    const std::size_t limb_index = bit / limb_bits, shift = bit % limb_bits;
+                    limb_type value = limb_index < scalar.size() ? scalar.limbs()[limb_index] >> shift : 0;
+                    if (shift + count > limb_bits && limb_index + 1 < scalar.size()) {
+                        value |= scalar.limbs()[limb_index + 1] << (limb_bits - shift);
+                    }
+                    return static_cast<std::size_t>(value) & ((std::size_t(1u) << count) - 1);
+                }
 
-                while (!(eval_is_zero(c))) {
-                    long u;
-                    if ((c.limbs()[0] & 1) == 1) {
-                        u = c.limbs()[0] % (1u << (window_size + 1));
-                        if (u > (1 << window_size)) {
-                            u = u - (1 << (window_size + 1));
+                //
+                // Writes the wNAF digits of scalar into res[0, bits], every nonzero digit is odd and less
+                // than 2^window_size by absolute value and is followed by at least window_size zeros. Scalar is
+                // consumed a window at a time: a carry bit replaces the subtraction of negative digits.
+                // Positions without a digit are left untouched. Returns the count of digits up to the last nonzero.
+                //
+                template<typename Digit, typename Backend>
+                constexpr std::size_t wnaf_recode(Digit* res, std::size_t window_size, const Backend& scalar,
+                                                  std::size_t bits) {
+                    std::size_t carry = 0, length = 0;
+                    for (std::size_t bit = 0; bit < bits;) {
+                        if (wnaf_get_bits(scalar, bit, 1) == carry) {
+                            ++bit;
+                            continue;
                         }
 
-                        if (u > 0) {
-                            eval_subtract(c, c, ui_type(u));
-                        } else {
-                            eval_add(c, c, ui_type(-u));
-                        }
-                    } else {
-                        u = 0;
+                        const std::size_t count = window_size + 1 < bits - bit ? window_size + 1 : bits - bit;
+                        const std::size_t word = wnaf_get_bits(scalar, bit, count) + carry;
+                        carry = (word >> window_size) & 1u;
+
+                        res[bit] =
+                            static_cast<Digit>(static_cast<long>(word) - static_cast<long>(carry << (window_size + 1)));
+                        length = bit + 1;
+                        bit += count;
                     }
-                    res[j] = u;
-                    ++j;
+                    if (carry) {
+                        res[bits] = 1;
+                        length = bits + 1;
+                    }
+                    return length;
+                }
 
-                    eval_right_shift(c, c, 1);    // c = c/2
+                template<typename Backend>
+                constexpr std::size_t wnaf_scalar_bits(const Backend& scalar) {
+                    return scalar.size() * sizeof(wnaf_limb_type<Backend>) * CHAR_BIT;
                 }
+            }    // namespace detail
+
+            template<typename Backend>
+            std::vector<long> eval_find_wnaf(const size_t window_size, const Backend& scalar) {
+                const std::size_t length = detail::wnaf_scalar_bits(scalar);    // upper bound
+                std::vector<long> res(wnaf_length(length));
+
+                detail::wnaf_recode(res.data(), window_size, scalar, length);
 
                 return res;
             }
 
+            //
+            // Allocation-free wNAF of scalar written into res, which should hold wnaf_length(bits) digits for a
+            // backend of bits bits. Returns the count of digits up to the last nonzero one, the rest of res is
+            // zeroed. window_size should be less than 8 for digits to fit int8_t.
+            //
+            template<std::size_t N, typename Backend>
+            constexpr std::size_t eval_find_wnaf(std::array<std::int8_t, N>& res, std::size_t window_size,
+                                                 const Backend& scalar) {
+                BOOST_ASSERT(window_size > 0 && window_size < 8);
+
+                const std::size_t bits = detail::wnaf_scalar_bits(scalar);
+                BOOST_ASSERT(wnaf_length(bits) <= N);
+
+                for (std::size_t i = 0; i < N; ++i) {
+                    res[i] = 0;
+                }
+                return detail::wnaf_recode(res.data(), window_size, scalar, bits);
+            }
+
+            //
+            // Signed fixed-window recoding for constant-time exponentiation and scalar multiplication: res[i] in
+            // [-2^(window_size - 1), 2^(window_size - 1)) and scalar = sum of res[i] * 2^(window_size * i) over all
+            // fixed_window_length(bits, window_size) digits. The digits of every window are computed by the same
+            // branch-free sequence of operations whatever the scalar is, zero digits included, and the count of
+            // digits depends on N only. Bits of scalar above (N - 1) * window_size are ignored, window_size should
+            // not exceed 8.
+            //
+            template<std::size_t N, typename Backend>
+            constexpr void eval_find_fixed_window(std::array<std::int8_t, N>& res, std::size_t window_size,
+                                                  const Backend& scalar) {
+                BOOST_ASSERT(window_size > 0 && window_size <= 8);
+
+                const std::size_t half = std::size_t(1u) << (window_size - 1);
+                std::size_t carry = 0;
+                for (std::size_t i = 0; i + 1 < N; ++i) {
+                    const std::size_t word = detail::wnaf_get_bits(scalar, i * window_size, window_size) + carry;
+                    carry = (word + half) >> window_size;
+                    res[i] =
+                        static_cast<std::int8_t>(static_cast<long>(word) - static_cast<long>(carry << window_size));
+                }
+                res[N - 1] = static_cast<std::int8_t>(carry);
+            }
+
             template<typename Backend, expression_template_option ExpressionTemplates>
             std::vector<long> find_wnaf(const size_t window_size, const number<Backend, ExpressionTemplates>& scalar) {
                 return eval_find_wnaf(window_size, scalar.backend());
             }
+
+            template<std::size_t N, typename Backend, expression_template_option ExpressionTemplates>
+            constexpr std::size_t find_wnaf(std::array<std::int8_t, N>& res, std::size_t window_size,
+                                            const number<Backend, ExpressionTemplates>& scalar) {
+                return eval_find_wnaf(res, window_size, scalar.backend());
+            }
+
+            template<std::size_t N, typename Backend, expression_template_option ExpressionTemplates>
+            constexpr void find_fixed_window(std::array<std::int8_t, N>& res, std::size_t window_size,
+                                             const number<Backend, ExpressionTemplates>& scalar) {
+                eval_find_fixed_window(res, window_size, scalar.backend());
+            }
         }    // namespace multiprecision
     }        // namespace crypto3
 }    // namespace nil
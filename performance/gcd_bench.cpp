@@ -191,8 +191,46 @@ static void BM_gcd_current(benchmark::State& state) {
     state.SetComplexityN(bits);
 }
 
+template<typename T>
+static void BM_gcdext_generic(benchmark::State& state) {
+    int bits = state.range(0);
+
+    std::vector<T>& a = get_test_vector_a<T>(bits);
+    std::vector<T>& b = get_test_vector_b<T>(bits);
+    std::vector<T>& c = get_test_vector_c<T>(bits);
+    typename T::backend_type x, y;
+
+    for (auto _ : state) {
+        for (unsigned i = 0; i < a.size(); ++i)
+            c[i].backend() = backends::eval_extended_euclidean_algorithm<typename T::backend_type>(
+                a[i].backend(), b[i].backend(), x, y);
+    }
+    state.SetComplexityN(bits);
+}
+
+template<typename T>
+static void BM_gcdext_current(benchmark::State& state) {
+    int bits = state.range(0);
+
+    std::vector<T>& a = get_test_vector_a<T>(bits);
+    std::vector<T>& b = get_test_vector_b<T>(bits);
+    std::vector<T>& c = get_test_vector_c<T>(bits);
+    typename T::backend_type x, y;
+
+    for (auto _ : state) {
+        for (unsigned i = 0; i < a.size(); ++i)
+            c[i].backend() = backends::eval_extended_euclidean_algorithm(a[i].backend(), b[i].backend(), x, y);
+    }
+    state.SetComplexityN(bits);
+}
+
 constexpr unsigned lower_range = 512;
 constexpr unsigned upper_range = 1 << 15;
+//
+// The half-gcd is taken from backends::gcd_half_gcd_threshold limbs on, the range covers the crossover
+//
+constexpr unsigned half_gcd_lower_range = 1 << 14;
+constexpr unsigned half_gcd_upper_range = 1 << 18;
 
 BENCHMARK_TEMPLATE(BM_gcd_old, cpp_int)
     ->RangeMultiplier(2)
@@ -219,5 +257,20 @@ BENCHMARK_TEMPLATE(BM_gcd_current, mpz_int)
     ->Range(lower_range, upper_range)
     ->Unit(benchmark::kMillisecond)
     ->Complexity();
+BENCHMARK_TEMPLATE(BM_gcd_current, cpp_int)
+    ->RangeMultiplier(2)
+    ->Range(half_gcd_lower_range, half_gcd_upper_range)
+    ->Unit(benchmark::kMillisecond)
+    ->Complexity();
+BENCHMARK_TEMPLATE(BM_gcdext_generic, cpp_int)
+    ->RangeMultiplier(2)
+    ->Range(half_gcd_lower_range, half_gcd_upper_range)
+    ->Unit(benchmark::kMillisecond)
+    ->Complexity();
+BENCHMARK_TEMPLATE(BM_gcdext_current, cpp_int)
+    ->RangeMultiplier(2)
+    ->Range(half_gcd_lower_range, half_gcd_upper_range)
+    ->Unit(benchmark::kMillisecond)
+    ->Complexity();
 
 BENCHMARK_MAIN();
@@ -0,0 +1,257 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+//
+// Compares dedicated fixed limb count Montgomery multiplication kernels with the generic CIOS loop
+// of modular_functions_fixed, Montgomery squaring with multiplication of a number by itself,
+// sliding window exponentiation with fixed window one and with fixed base comb, powm of cpp_int with
+// the temporary Montgomery context for odd moduli and with the generic algorithm.
+// Build with -mbmi2 -madx (or -march=native) and -DBOOST_MP_USE_MULX_ADX
+// to enable the mulx/adcx/adox path.
+//
+
+#include <benchmark/benchmark.h>
+
+#include <nil/crypto3/multiprecision/cpp_int.hpp>
+#include <nil/crypto3/multiprecision/modular/modular_adaptor.hpp>
+#include <nil/crypto3/multiprecision/modular/fixed_base_exponentiator.hpp>
+
+#include <boost/random.hpp>
+
+#include <cstddef>
+#include <vector>
+
+using namespace nil::crypto3::multiprecision;
+
+template<unsigned Bits>
+struct montgomery_mul_fixture {
+    typedef modular_fixed_cpp_int_backend<Bits, signed_magnitude, unchecked> backend_type;
+    typedef number<backend_type> number_type;
+    typedef backends::modular_functions_fixed<backend_type> modular_functions_type;
+
+    static constexpr std::size_t elements_count = 1024;
+
+    montgomery_mul_fixture() {
+        boost::random::mt19937 gen(Bits);
+        boost::random::independent_bits_engine<
+            boost::random::mt19937, Bits,
+            number<cpp_int_backend<Bits, Bits, unsigned_magnitude, unchecked, void>>>
+            bits_gen(gen);
+
+        number_type m(bits_gen());
+        bit_set(m, Bits - 1);
+        bit_set(m, 0);
+        mod = modular_functions_type(m);
+
+        for (std::size_t i = 0; i < elements_count; ++i) {
+            number_type x(bits_gen());
+            x %= m;
+            elements.push_back(x.backend());
+        }
+    }
+
+    static const montgomery_mul_fixture& instance() {
+        static const montgomery_mul_fixture fixture;
+        return fixture;
+    }
+
+    modular_functions_type mod;
+    std::vector<backend_type> elements;
+};
+
+template<unsigned Bits>
+static void BM_montgomery_mul_generic(benchmark::State& state) {
+    typedef montgomery_mul_fixture<Bits> fixture_type;
+    const fixture_type& fixture = fixture_type::instance();
+
+    typename fixture_type::backend_type acc = fixture.elements[0];
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < fixture_type::elements_count; ++i) {
+            fixture.mod.montgomery_mul_impl(acc, acc, fixture.elements[i],
+                                            static_cast<std::size_t>(fixture.mod.get_mod().backend().size()));
+        }
+        benchmark::DoNotOptimize(acc);
+    }
+    state.SetItemsProcessed(state.iterations() * fixture_type::elements_count);
+}
+
+template<unsigned Bits>
+static void BM_montgomery_mul_kernel(benchmark::State& state) {
+    typedef montgomery_mul_fixture<Bits> fixture_type;
+    const fixture_type& fixture = fixture_type::instance();
+
+    typename fixture_type::backend_type acc = fixture.elements[0];
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < fixture_type::elements_count; ++i) {
+            fixture.mod.montgomery_mul(acc, acc, fixture.elements[i]);
+        }
+        benchmark::DoNotOptimize(acc);
+    }
+    state.SetItemsProcessed(state.iterations() * fixture_type::elements_count);
+}
+
+template<unsigned Bits>
+static void BM_montgomery_sqr_as_mul(benchmark::State& state) {
+    typedef montgomery_mul_fixture<Bits> fixture_type;
+    const fixture_type& fixture = fixture_type::instance();
+
+    typename fixture_type::backend_type acc = fixture.elements[0];
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < fixture_type::elements_count; ++i) {
+            fixture.mod.montgomery_mul(acc, acc, acc);
+        }
+        benchmark::DoNotOptimize(acc);
+    }
+    state.SetItemsProcessed(state.iterations() * fixture_type::elements_count);
+}
+
+template<unsigned Bits>
+static void BM_montgomery_sqr(benchmark::State& state) {
+    typedef montgomery_mul_fixture<Bits> fixture_type;
+    const fixture_type& fixture = fixture_type::instance();
+
+    typename fixture_type::backend_type acc = fixture.elements[0];
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < fixture_type::elements_count; ++i) {
+            fixture.mod.montgomery_sqr(acc);
+        }
+        benchmark::DoNotOptimize(acc);
+    }
+    state.SetItemsProcessed(state.iterations() * fixture_type::elements_count);
+}
+
+template<unsigned Bits>
+static void BM_montgomery_exp(benchmark::State& state) {
+    typedef montgomery_mul_fixture<Bits> fixture_type;
+    const fixture_type& fixture = fixture_type::instance();
+
+    typename fixture_type::backend_type acc;
+    std::size_t i = 0;
+    for (auto _ : state) {
+        fixture.mod.montgomery_exp(acc, fixture.elements[i % fixture_type::elements_count],
+                                   fixture.elements[(i + 1) % fixture_type::elements_count]);
+        benchmark::DoNotOptimize(acc);
+        ++i;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<unsigned Bits>
+static void BM_montgomery_exp_fixed_window(benchmark::State& state) {
+    typedef montgomery_mul_fixture<Bits> fixture_type;
+    const fixture_type& fixture = fixture_type::instance();
+
+    typename fixture_type::backend_type acc;
+    std::size_t i = 0;
+    for (auto _ : state) {
+        fixture.mod.montgomery_exp_fixed_window(acc, fixture.elements[i % fixture_type::elements_count],
+                                                fixture.elements[(i + 1) % fixture_type::elements_count]);
+        benchmark::DoNotOptimize(acc);
+        ++i;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<unsigned Bits>
+static void BM_fixed_base_pow(benchmark::State& state) {
+    typedef montgomery_mul_fixture<Bits> fixture_type;
+    typedef typename fixture_type::backend_type backend_type;
+    const fixture_type& fixture = fixture_type::instance();
+
+    modular_params<backend_type> mod(fixture.mod.get_mod());
+    fixed_base_exponentiator<backend_type> exponentiator(number<backend_type>(fixture.elements[0]), mod, Bits,
+                                                         state.range(0));
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            exponentiator.pow(number<backend_type>(fixture.elements[(i + 1) % fixture_type::elements_count])));
+        ++i;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<unsigned Bits>
+struct cpp_int_powm_fixture {
+    cpp_int_powm_fixture() {
+        boost::random::mt19937 gen(Bits);
+        boost::random::independent_bits_engine<boost::random::mt19937, Bits, cpp_int> bits_gen(gen);
+
+        m = bits_gen();
+        bit_set(m, Bits - 1);
+        bit_set(m, 0);
+        base = bits_gen() % m;
+        exp = bits_gen();
+    }
+
+    static const cpp_int_powm_fixture& instance() {
+        static const cpp_int_powm_fixture fixture;
+        return fixture;
+    }
+
+    cpp_int m, base, exp;
+};
+
+template<unsigned Bits>
+static void BM_cpp_int_powm(benchmark::State& state) {
+    const cpp_int_powm_fixture<Bits>& fixture = cpp_int_powm_fixture<Bits>::instance();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(cpp_int(powm(fixture.base, fixture.exp, fixture.m)));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<unsigned Bits>
+static void BM_cpp_int_powm_generic(benchmark::State& state) {
+    const cpp_int_powm_fixture<Bits>& fixture = cpp_int_powm_fixture<Bits>::instance();
+
+    cpp_int result;
+    for (auto _ : state) {
+        default_ops::eval_powm(result.backend(), fixture.base.backend(), fixture.exp.backend(),
+                               fixture.m.backend());
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(BM_montgomery_mul_generic, 256);
+BENCHMARK_TEMPLATE(BM_montgomery_mul_kernel, 256);
+BENCHMARK_TEMPLATE(BM_montgomery_mul_generic, 384);
+BENCHMARK_TEMPLATE(BM_montgomery_mul_kernel, 384);
+BENCHMARK_TEMPLATE(BM_montgomery_mul_generic, 512);
+BENCHMARK_TEMPLATE(BM_montgomery_mul_kernel, 512);
+BENCHMARK_TEMPLATE(BM_montgomery_mul_generic, 768);
+BENCHMARK_TEMPLATE(BM_montgomery_mul_kernel, 768);
+
+BENCHMARK_TEMPLATE(BM_montgomery_sqr_as_mul, 256);
+BENCHMARK_TEMPLATE(BM_montgomery_sqr, 256);
+BENCHMARK_TEMPLATE(BM_montgomery_sqr_as_mul, 384);
+BENCHMARK_TEMPLATE(BM_montgomery_sqr, 384);
+BENCHMARK_TEMPLATE(BM_montgomery_sqr_as_mul, 512);
+BENCHMARK_TEMPLATE(BM_montgomery_sqr, 512);
+BENCHMARK_TEMPLATE(BM_montgomery_sqr_as_mul, 768);
+BENCHMARK_TEMPLATE(BM_montgomery_sqr, 768);
+
+BENCHMARK_TEMPLATE(BM_montgomery_exp, 256);
+BENCHMARK_TEMPLATE(BM_montgomery_exp_fixed_window, 256);
+BENCHMARK_TEMPLATE(BM_montgomery_exp, 512);
+BENCHMARK_TEMPLATE(BM_montgomery_exp_fixed_window, 512);
+BENCHMARK_TEMPLATE(BM_montgomery_exp, 768);
+BENCHMARK_TEMPLATE(BM_montgomery_exp_fixed_window, 768);
+
+BENCHMARK_TEMPLATE(BM_fixed_base_pow, 256)->Arg(4)->Arg(8);
+BENCHMARK_TEMPLATE(BM_fixed_base_pow, 512)->Arg(4)->Arg(8);
+
+BENCHMARK_TEMPLATE(BM_cpp_int_powm, 1024)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_cpp_int_powm_generic, 1024)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_cpp_int_powm, 2048)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_cpp_int_powm_generic, 2048)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_cpp_int_powm, 4096)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_cpp_int_powm_generic, 4096)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
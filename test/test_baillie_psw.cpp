@@ -0,0 +1,91 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2020 Mikhail Komarov. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+#include <nil/crypto3/multiprecision/gmp.hpp>
+#include <nil/crypto3/multiprecision/cpp_int.hpp>
+#include <nil/crypto3/multiprecision/baillie_psw.hpp>
+#include <boost/math/special_functions/prime.hpp>
+#include <iostream>
+#include <iomanip>
+#include "test.hpp"
+
+template<class I>
+void test() {
+    //
+    // Verify that GMP's Miller-Rabin implementation and Baillie-PSW agree on random numbers, no composite
+    // is known to pass Baillie-PSW.
+    //
+    using namespace boost::random;
+    using namespace nil::crypto3::multiprecision;
+
+    typedef I test_type;
+
+    static const unsigned test_bits =
+        std::numeric_limits<test_type>::digits && (std::numeric_limits<test_type>::digits <= 256) ?
+            std::numeric_limits<test_type>::digits :
+            128;
+
+    independent_bits_engine<mt11213b, test_bits, test_type> gen;
+
+    for (unsigned i = 1; i < boost::math::max_prime; ++i) {
+        BOOST_TEST(baillie_psw_test(test_type(boost::math::prime(i))));
+    }
+
+    for (unsigned i = 0; i < 10000; ++i) {
+        test_type n = gen();
+        bool is_prime_boost = baillie_psw_test(n);
+        bool is_gmp_prime = mpz_probab_prime_p(mpz_int(n).backend().data(), 25) ? true : false;
+        if (is_prime_boost != is_gmp_prime)
+            std::cout << std::hex << std::showbase << "n = " << n << std::endl;
+        BOOST_CHECK_EQUAL(is_prime_boost, is_gmp_prime);
+    }
+
+    //
+    // Strong pseudoprimes to base 2 are caught by the Lucas half, strong Lucas pseudoprimes by the base 2 half:
+    //
+    const unsigned strong_pseudoprimes[] = {2047u, 3277u, 4033u, 4681u, 8321u};
+    for (unsigned n : strong_pseudoprimes) {
+        baillie_psw_engine<test_type> engine((test_type(n)));
+        BOOST_TEST(engine.is_strong_probable_prime(test_type(2u)));
+        BOOST_TEST(!engine.is_strong_lucas_probable_prime());
+        BOOST_TEST(!engine.is_probable_prime());
+    }
+    const unsigned strong_lucas_pseudoprimes[] = {5459u, 5777u, 10877u, 16109u, 18971u};
+    for (unsigned n : strong_lucas_pseudoprimes) {
+        baillie_psw_engine<test_type> engine((test_type(n)));
+        BOOST_TEST(engine.is_strong_lucas_probable_prime());
+        BOOST_TEST(!engine.is_probable_prime());
+    }
+
+    // perfect squares have no D with jacobi(D, n) = -1
+    BOOST_TEST(!baillie_psw_test(test_type(1009u) * 1009u));
+    // Mersenne prime, n + 1 is a power of two
+    BOOST_TEST(baillie_psw_test((test_type(1u) << 61u) - 1u));
+    BOOST_TEST(!baillie_psw_test((test_type(1u) << 67u) - 1u));
+}
+
+int main() {
+    using namespace nil::crypto3::multiprecision;
+
+    test<mpz_int>();
+    test<cpp_int>();
+    test<checked_uint128_t>();
+    test<number<cpp_int_backend<256, 256, unsigned_magnitude, unchecked, void>>>();
+    test<checked_uint1024_t>();
+
+    //
+    // The largest value of a fixed width type:
+    //
+    typedef number<cpp_int_backend<127, 127, unsigned_magnitude, checked, void>> checked_uint127_t;
+    BOOST_TEST(baillie_psw_test((std::numeric_limits<checked_uint127_t>::max)()));
+    BOOST_TEST(baillie_psw_test(cpp_int((cpp_int(1u) << 521u) - 1u)));
+    BOOST_TEST(!baillie_psw_test(cpp_int((cpp_int(1u) << 523u) - 1u)));
+
+    return boost::report_errors();
+}
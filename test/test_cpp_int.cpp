@@ -111,6 +111,12 @@ struct tester {
         BOOST_CHECK_EQUAL((mpz_int(c) *= -d).str(), (test_type(c1) *= -d1).str());
         BOOST_CHECK_EQUAL((mpz_int(-d) *= c).str(), (test_type(-d1) *= c1).str());
         BOOST_CHECK_EQUAL(mpz_int(b * c).str(), test_type(b1 * c1).str());
+        BOOST_CHECK_EQUAL(mpz_int(c * c).str(), test_type(c1 * c1).str());
+        test_type s1(d1);
+        s1 *= s1;
+        BOOST_CHECK_EQUAL(mpz_int(d * d).str(), s1.str());
+        BOOST_CHECK_EQUAL(mpz_int(square(c)).str(), test_type(square(c1)).str());
+        BOOST_CHECK_EQUAL(mpz_int(square(-d)).str(), test_type(square(-d1)).str());
         BOOST_CHECK_EQUAL(mpz_int(a / b).str(), test_type(a1 / b1).str());
         BOOST_CHECK_EQUAL((mpz_int(a) /= b).str(), (test_type(a1) /= b1).str());
         BOOST_CHECK_EQUAL(mpz_int(a / -b).str(), test_type(a1 / -b1).str());
@@ -421,11 +427,41 @@ struct tester {
             BOOST_CHECK_EQUAL(mpz_int(powm(a, b, c)).str(), test_type(powm(a1, b1, c1)).str());
             BOOST_CHECK_EQUAL(mpz_int(powm(a, b, ui)).str(), test_type(powm(a1, b1, ui)).str());
             BOOST_CHECK_EQUAL(mpz_int(powm(a, ui, c)).str(), test_type(powm(a1, ui, c1)).str());
+            // built-in exponents should agree with the same exponents as numbers, odd moduli take Montgomery's path:
+            const test_type odd_c1 = c1 | 1u;
+            BOOST_CHECK_EQUAL(test_type(powm(a1, ui, odd_c1)), test_type(powm(a1, test_type(ui), odd_c1)));
+            BOOST_CHECK_EQUAL(test_type(powm(a1, 65537u, odd_c1)), test_type(powm(a1, test_type(65537u), odd_c1)));
+            BOOST_CHECK_EQUAL(test_type(powm(a1, large_ui, odd_c1)),
+                              test_type(powm(a1, test_type(large_ui), odd_c1)));
+            BOOST_CHECK_EQUAL(test_type(powm(a1, 3, odd_c1)), test_type(powm(a1, test_type(3), odd_c1)));
         }
         BOOST_CHECK_EQUAL(lsb(a), lsb(a1));
         BOOST_CHECK_EQUAL(msb(a), msb(a1));
     }
 
+    static void test_powm_windows() {
+        using namespace nil::crypto3::multiprecision;
+        if (!std::numeric_limits<test_type>::is_bounded) {
+            //
+            // Exponents on both sides of every sliding window threshold, with odd moduli taking the Montgomery
+            // path, both with the unrolled and the generic kernels, and even moduli taking the generic one:
+            //
+            const mpz_int base("0x1234567890abcdef1234567890abcdef1234567890abcdeffedcba987654321f0f0f0f");
+            const mpz_int exp_all = (mpz_int(1) << 1100u) / 7u + 12345u;
+            for (unsigned mod_bits : {64u, 256u, 1000u}) {
+                for (unsigned odd = 0; odd < 2; ++odd) {
+                    const mpz_int m = (mpz_int(1) << (mod_bits - 1u)) + 2022u + odd;
+                    for (unsigned exp_bits : {1u, 2u, 23u, 24u, 79u, 80u, 239u, 240u, 671u, 672u, 1024u}) {
+                        const mpz_int e = exp_all >> (msb(exp_all) + 1u - exp_bits);
+                        BOOST_CHECK_EQUAL(
+                            mpz_int(powm(base, e, m)).str(),
+                            test_type(powm(test_type(base.str()), test_type(e.str()), test_type(m.str()))).str());
+                    }
+                }
+            }
+        }
+    }
+
     static void test_bug_cases() {
         if (!std::numeric_limits<test_type>::is_bounded) {
             // https://svn.boost.org/trac/boost/ticket/7878
@@ -736,6 +772,7 @@ struct tester {
         using namespace nil::crypto3::multiprecision;
 
         test_bug_cases();
+        test_powm_windows();
 
         last_error_count = 0;
 
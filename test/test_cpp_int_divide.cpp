@@ -0,0 +1,134 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE cpp_int_divide_test
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/multiprecision/cpp_int.hpp>
+
+#include <boost/random.hpp>
+
+using namespace nil::crypto3::multiprecision;
+
+typedef number<backends::cpp_int_backend<65536, 65536, unsigned_magnitude, unchecked, void>> uint65536_t;
+
+cpp_int random_integer(boost::random::mt19937& gen, unsigned bits) {
+    boost::random::independent_bits_engine<boost::random::mt19937, 32, std::uint32_t> bits_gen(gen);
+    cpp_int result;
+    for (unsigned i = 0; i < bits; i += 32) {
+        result <<= 32;
+        result |= bits_gen();
+    }
+    return result;
+}
+
+//
+// The quotient and the remainder are the only ones with x = q y + r, |r| < |y| and r of the sign of x
+//
+void check_division(const cpp_int& x, const cpp_int& y, const cpp_int& q, const cpp_int& r) {
+    BOOST_CHECK_EQUAL(q * y + r, x);
+    BOOST_CHECK(abs(r) < abs(y));
+    BOOST_CHECK(r == 0 || ((r < 0) == (x < 0)));
+}
+
+void check_divide(const cpp_int& x, const cpp_int& y) {
+    check_division(x, y, x / y, x % y);
+    check_division(-x, y, -x / y, -x % y);
+
+    const divider<cpp_int::backend_type> d(y);
+    cpp_int q, r;
+    d.divide_qr(x, q, r);
+    check_division(x, y, q, r);
+    BOOST_CHECK_EQUAL(d.divide(x), q);
+    BOOST_CHECK_EQUAL(d.mod(x), r);
+    d.divide_qr(-x, q, r);
+    BOOST_CHECK_EQUAL(q, -x / y);
+    BOOST_CHECK_EQUAL(r, -x % y);
+}
+
+BOOST_AUTO_TEST_SUITE(divide_tests)
+
+BOOST_AUTO_TEST_CASE(random_operands) {
+    boost::random::mt19937 gen(23);
+    const unsigned bits = backends::burnikel_ziegler_cutoff * bits_per_limb;
+    for (unsigned y_bits : {bits / 2, bits + 1, 3 * bits, 10 * bits}) {
+        for (unsigned x_bits : {y_bits - 1, y_bits + 64, 2 * y_bits - 1, 2 * y_bits + 33, 7 * y_bits}) {
+            check_divide(random_integer(gen, x_bits), random_integer(gen, y_bits) | 1);
+            /// divisors with their most significant bit set need no normalization
+            const cpp_int y = random_integer(gen, y_bits) | (cpp_int(1) << ((y_bits + 63) / 64 * 64 - 1));
+            check_divide(random_integer(gen, x_bits), y);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(special_operands) {
+    const unsigned bits = backends::burnikel_ziegler_cutoff * bits_per_limb * 4;
+    const cpp_int a = (cpp_int(1) << (2 * bits)) - 1, b = (cpp_int(1) << bits) - 1;
+    check_divide(a, b);
+    check_divide(a, b + 2);
+    check_divide(a - 1, b);
+    check_divide(a * b, b);
+    check_divide(cpp_int(1) << (2 * bits), (cpp_int(1) << bits) + 1);
+    check_divide(cpp_int(1) << (2 * bits - 1), cpp_int(1) << (bits - 1));
+    check_divide(b, b);
+    check_divide(b - 1, b);
+}
+
+BOOST_AUTO_TEST_CASE(single_limb_divisors) {
+    boost::random::mt19937 gen(26);
+    for (unsigned y_bits : {2u, 17u, 63u, 64u}) {
+        const cpp_int y = (random_integer(gen, 64) >> (64 - y_bits)) | 1;
+        const std::uint64_t m = static_cast<std::uint64_t>(y);
+        for (unsigned x_bits : {32u, 64u, 65u, 1000u}) {
+            const cpp_int x = random_integer(gen, x_bits);
+            check_divide(x, y);
+            BOOST_CHECK_EQUAL(integer_modulus(x, m), static_cast<std::uint64_t>(x % y));
+            BOOST_CHECK_EQUAL(cpp_int(x % m), x % y);
+        }
+    }
+    check_divide(cpp_int(0), cpp_int(3));
+    check_divide((cpp_int(1) << 1000) - 1, cpp_int(~std::uint64_t(0)));
+}
+
+BOOST_AUTO_TEST_CASE(newton_reciprocal) {
+    boost::random::mt19937 gen(24);
+    const unsigned bits = backends::newton_division_cutoff * bits_per_limb;
+    const cpp_int y = random_integer(gen, bits + 100);
+    check_divide(random_integer(gen, 5 * bits), y);
+    check_divide((cpp_int(1) << (5 * bits)) - 1, (cpp_int(1) << bits) - 1);
+
+    cpp_int r;
+    backends::divide_newton_reciprocal(r.backend(), (cpp_int(1) << (bits - 1)).backend());
+    BOOST_CHECK_EQUAL(r, cpp_int(1) << (bits + 1));
+}
+
+BOOST_AUTO_TEST_CASE(fixed_precision) {
+    boost::random::mt19937 gen(25);
+    const unsigned bits = backends::burnikel_ziegler_cutoff * bits_per_limb * 4;
+    const uint65536_t x = uint65536_t(random_integer(gen, 3 * bits)), y = uint65536_t(random_integer(gen, bits));
+    const cpp_int q = cpp_int(x) / cpp_int(y), r = cpp_int(x) % cpp_int(y);
+    BOOST_CHECK_EQUAL(cpp_int(x / y), q);
+    BOOST_CHECK_EQUAL(cpp_int(x % y), r);
+
+    const divider<uint65536_t::backend_type> d(y);
+    BOOST_CHECK_EQUAL(cpp_int(d.divide(x)), q);
+    BOOST_CHECK_EQUAL(cpp_int(d.mod(x)), r);
+}
+
+BOOST_AUTO_TEST_CASE(division_by_zero) {
+    BOOST_CHECK_THROW(divider<cpp_int::backend_type>(cpp_int(0)), std::overflow_error);
+
+    const divider<cpp_int::backend_type> dv;
+    cpp_int q, r;
+    BOOST_CHECK_THROW(dv.divide(cpp_int(7)), std::overflow_error);
+    BOOST_CHECK_THROW(dv.mod(cpp_int(7)), std::overflow_error);
+    BOOST_CHECK_THROW(dv.divide_qr(cpp_int(7), q, r), std::overflow_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
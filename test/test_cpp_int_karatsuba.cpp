@@ -151,7 +151,7 @@ typename boost::enable_if_c<
     mpz_int a, b;
     N x, y;
 
-    unsigned upper_limit = std::numeric_limits<N>::is_bounded ? std::numeric_limits<N>::digits - 1 : 8192 * 2;
+    unsigned upper_limit = std::numeric_limits<N>::is_bounded ? std::numeric_limits<N>::digits - 1 : 8192 * 32;
     for (unsigned i = 1024; i < upper_limit; i *= 2) {
         a = 1;
         a <<= i;
@@ -175,6 +175,17 @@ typename boost::enable_if_c<
             std::cout << b << std::endl;
             std::cout << y << std::endl;
         }
+        //
+        // Unbalanced arguments, these go through the Toom-32, Toom-42 and sliced multiplication for large i:
+        //
+        for (unsigned j = 2; j < 8; j += 2) {
+            b = a * (a >> (i - 2 * i / (j + 1)));
+            if (std::numeric_limits<N>::is_bounded)
+                b &= mask;
+            y = x * (x >> (i - 2 * i / (j + 1)));
+
+            BOOST_CHECK_EQUAL(y.str(), b.str());
+        }
     }
 }
 template<class N>
@@ -235,7 +246,7 @@ typename boost::disable_if_c<
     mpz_int a, b;
     N x, y;
 
-    unsigned upper_limit = std::numeric_limits<N>::is_bounded ? std::numeric_limits<N>::digits - 1 : 8192 * 2;
+    unsigned upper_limit = std::numeric_limits<N>::is_bounded ? std::numeric_limits<N>::digits - 1 : 8192 * 32;
     for (unsigned i = 1024; i < upper_limit; i *= 2) {
         a = 1;
         a <<= i;
@@ -259,6 +270,17 @@ typename boost::disable_if_c<
             std::cout << b << std::endl;
             std::cout << y << std::endl;
         }
+        //
+        // Unbalanced arguments, these go through the Toom-32, Toom-42 and sliced multiplication for large i:
+        //
+        for (unsigned j = 2; j < 8; j += 2) {
+            b = a * (a >> (i - 2 * i / (j + 1)));
+            if (std::numeric_limits<N>::is_bounded)
+                b &= mask;
+            y = x * (x >> (i - 2 * i / (j + 1)));
+
+            BOOST_CHECK_EQUAL(y.str(), b.str());
+        }
     }
 }
 
@@ -276,6 +298,10 @@ int main() {
 #endif
 #if (TEST == 4) || (TEST == 0)
     test(number<cpp_int_backend<8192, 8192, unsigned_magnitude, unchecked>>());
+#endif
+#if (TEST == 5) || (TEST == 0)
+    // Large enough for the Toom-Cook tiers:
+    test(number<cpp_int_backend<65536, 65536, unsigned_magnitude, unchecked>>());
 #endif
     return boost::report_errors();
 }
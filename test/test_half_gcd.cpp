@@ -0,0 +1,145 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE half_gcd_multiprecision_test
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/multiprecision/gmp.hpp>
+#include <nil/crypto3/multiprecision/cpp_int.hpp>
+#include <nil/crypto3/multiprecision/inverse.hpp>
+
+#include <boost/random.hpp>
+
+using namespace nil::crypto3::multiprecision;
+
+typedef cpp_int::backend_type backend_type;
+
+cpp_int random_integer(boost::random::mt19937& gen, unsigned bits) {
+    boost::random::independent_bits_engine<boost::random::mt19937, 32, std::uint32_t> bits_gen(gen);
+    cpp_int result;
+    for (unsigned i = 0; i < bits; i += 32) {
+        result <<= 32;
+        result |= bits_gen();
+    }
+    return result;
+}
+
+//
+// The half-gcd results are checked against the generic extended Euclidean algorithm, which never reaches the half-gcd,
+// and against mpz_gcdext. All of them return the unique cofactors with |x| <= b / 2g and |y| <= a / 2g.
+//
+void check_gcd(const cpp_int& a, const cpp_int& b) {
+    backend_type x, y, a_backend = a.backend(), b_backend = b.backend();
+    const cpp_int g = cpp_int(backends::eval_extended_euclidean_algorithm(a_backend, b_backend, x, y));
+
+    backend_type x_reference, y_reference;
+    const cpp_int g_reference = cpp_int(
+        backends::eval_extended_euclidean_algorithm<backend_type>(a_backend, b_backend, x_reference, y_reference));
+
+    BOOST_CHECK_EQUAL(g, g_reference);
+    BOOST_CHECK_EQUAL(cpp_int(x), cpp_int(x_reference));
+    BOOST_CHECK_EQUAL(cpp_int(y), cpp_int(y_reference));
+    BOOST_CHECK_EQUAL(gcd(a, b), g_reference);
+    BOOST_CHECK_EQUAL(gcd(b, a), g_reference);
+    BOOST_CHECK_EQUAL(cpp_int(x) * a + cpp_int(y) * b, g);
+
+    const mpz_int a_gmp(a.str()), b_gmp(b.str());
+    mpz_int g_gmp, x_gmp, y_gmp;
+    mpz_gcdext(g_gmp.backend().data(), x_gmp.backend().data(), y_gmp.backend().data(), a_gmp.backend().data(),
+               b_gmp.backend().data());
+    BOOST_CHECK_EQUAL(g.str(), g_gmp.str());
+    BOOST_CHECK_EQUAL(cpp_int(x).str(), x_gmp.str());
+    BOOST_CHECK_EQUAL(cpp_int(y).str(), y_gmp.str());
+}
+
+//
+// The Lehmer inverse is checked against the generic one, which runs the plain extended Euclidean algorithm
+//
+void check_inverse(const cpp_int& a, const cpp_int& m) {
+    backend_type result, result_reference;
+    backends::eval_inverse_extended_euclidean_algorithm(result, a.backend(), m.backend());
+    backends::eval_inverse_extended_euclidean_algorithm<backend_type>(result_reference, a.backend(), m.backend());
+
+    BOOST_CHECK_EQUAL(cpp_int(result), cpp_int(result_reference));
+    if (gcd(a, m) == 1) {
+        BOOST_CHECK_EQUAL(cpp_int(result) * a % m, m == 1 ? 0 : 1);
+        BOOST_CHECK(cpp_int(result) < m);
+    } else {
+        BOOST_CHECK_EQUAL(cpp_int(result), 0);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(half_gcd_tests)
+
+BOOST_AUTO_TEST_CASE(random_operands) {
+    boost::random::mt19937 gen(17);
+    const unsigned bits = backends::gcd_half_gcd_threshold * bits_per_limb * 3 / 2;
+    for (unsigned i = 0; i < 3; ++i) {
+        check_gcd(random_integer(gen, bits), random_integer(gen, bits));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(unbalanced_operands) {
+    boost::random::mt19937 gen(18);
+    const unsigned bits = backends::gcd_half_gcd_threshold * bits_per_limb * 3 / 2;
+    check_gcd(random_integer(gen, bits), random_integer(gen, bits - 100));
+    check_gcd(random_integer(gen, bits), random_integer(gen, bits * 2 / 3));
+    check_gcd(random_integer(gen, bits * 2), random_integer(gen, bits));
+}
+
+BOOST_AUTO_TEST_CASE(common_factors) {
+    boost::random::mt19937 gen(19);
+    const unsigned bits = backends::gcd_half_gcd_threshold * bits_per_limb;
+    const cpp_int c = random_integer(gen, bits / 2);
+    check_gcd(random_integer(gen, bits) * c, random_integer(gen, bits) * c);
+    /// the common factor is larger than the half-gcd threshold
+    const cpp_int d = random_integer(gen, bits + 100);
+    check_gcd(random_integer(gen, bits / 4) * d, random_integer(gen, bits / 4) * d);
+    check_gcd(d << 1000, d << 777);
+}
+
+BOOST_AUTO_TEST_CASE(special_operands) {
+    const unsigned bits = backends::gcd_half_gcd_threshold * bits_per_limb * 3 / 2;
+    const cpp_int a = (cpp_int(1) << bits) - 1;
+    check_gcd(a, a - 1);
+    check_gcd(a, a - 2);
+    check_gcd(a, a);
+    check_gcd(a, (cpp_int(1) << (bits / 2)) - 1);
+    /// consecutive Fibonacci numbers take the maximal number of steps
+    cpp_int f0 = 1, f1 = 1;
+    while (msb(f1) < bits) {
+        f0 += f1;
+        f0.swap(f1);
+    }
+    check_gcd(f1, f0);
+}
+
+BOOST_AUTO_TEST_CASE(inverse_operands) {
+    boost::random::mt19937 gen(20);
+    for (unsigned bits : {64u, 256u, 521u, 2048u, backends::gcd_half_gcd_threshold * bits_per_limb * 3 / 2}) {
+        const cpp_int m = random_integer(gen, bits) | 1;
+        check_inverse(random_integer(gen, bits) % m, m);
+        /// even modulus and an argument larger than the modulus
+        check_inverse(random_integer(gen, bits * 2), m + 1);
+        /// no inverse exists
+        const cpp_int c = random_integer(gen, bits / 2) | 1;
+        check_inverse(random_integer(gen, bits) * c, m * c);
+    }
+    const cpp_int p = (cpp_int(1) << 255) - 19;
+    check_inverse(p - 1, p);
+    check_inverse(p, p);
+    check_inverse(p + 2, p);
+
+    typedef number<backends::cpp_int_backend<256, 256, signed_magnitude, unchecked, void>> int256_t;
+    const int256_t a = int256_t(random_integer(gen, 250)), q = int256_t(p);
+    const int256_t x = inverse_extended_euclidean_algorithm(a, q);
+    BOOST_CHECK_EQUAL(cpp_int(x) * cpp_int(a) % p, 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
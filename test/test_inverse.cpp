@@ -33,6 +33,7 @@
 #endif
 
 #include <nil/crypto3/multiprecision/inverse.hpp>
+#include <nil/crypto3/multiprecision/parallel_inverse.hpp>
 #include <nil/crypto3/multiprecision/modular/modular_adaptor.hpp>
 #include <nil/crypto3/multiprecision/modular/modular_params.hpp>
 #include <nil/crypto3/multiprecision/number.hpp>
@@ -295,6 +296,80 @@ void test_cpp_int_backend() {
     BOOST_CHECK_EQUAL(number<T>(res.backend()), number<T>(140404367363));
 }
 
+template<typename T>
+void test_batch_inverse_mod() {
+    typedef number<backends::modular_adaptor<T>> modular_number;
+
+    const number<T> mod("0xffffffff00000001000000000000000000000000ffffffffffffffffffffffff");
+
+    std::vector<modular_number> elements;
+    number<T> x("0x1234567890abcdef1234567890abcdef1234567890abcdef1234567890abcdef");
+    for (std::size_t i = 0; i < 300; ++i) {
+        elements.emplace_back(i % 5 == 2 ? number<T>(0) : x, mod);
+        /// the square is taken in cpp_int so that it does not overflow fixed precision types
+        x = number<T>((cpp_int(x) * cpp_int(x) + 1) % cpp_int(mod));
+    }
+
+    std::vector<modular_number> inverted(elements), inverted_parallel(elements), empty;
+    BOOST_CHECK(batch_inverse_mod(inverted.begin(), inverted.end()));
+    BOOST_CHECK(parallel_batch_inverse_mod(inverted_parallel.begin(), inverted_parallel.end(), 3));
+    BOOST_CHECK(batch_inverse_mod(empty.begin(), empty.end()));
+
+    const modular_number one(1, mod);
+    for (std::size_t i = 0; i < elements.size(); ++i) {
+        if (elements[i].is_zero()) {
+            BOOST_CHECK(inverted[i].is_zero());
+        } else {
+            BOOST_CHECK(inverted[i] * elements[i] == one);
+            BOOST_CHECK(inverted[i] == inverse_mod(elements[i]));
+        }
+        BOOST_CHECK(inverted_parallel[i] == inverted[i]);
+    }
+
+    std::vector<modular_number> single(1, modular_number(3, 8));
+    BOOST_CHECK(batch_inverse_mod(single.begin(), single.end()));
+    BOOST_CHECK(single[0] == modular_number(3, 8));
+
+    /// a single element sharing a factor with the modulus (2^127 - 1) (2^61 - 1) is reported, nothing is written
+    const number<T> factor = (number<T>(1) << 61) - 1, composite = ((number<T>(1) << 127) - 1) * factor;
+    std::vector<modular_number> composite_elements;
+    for (std::size_t i = 0; i < 300; ++i) {
+        composite_elements.emplace_back(i == 250 ? factor * 5 : number<T>(i + 1), composite);
+    }
+    std::vector<modular_number> not_inverted(composite_elements), not_inverted_parallel(composite_elements);
+    BOOST_CHECK(!batch_inverse_mod(not_inverted.begin(), not_inverted.end()));
+    BOOST_CHECK(!parallel_batch_inverse_mod(not_inverted_parallel.begin(), not_inverted_parallel.end(), 3));
+    for (std::size_t i = 0; i < composite_elements.size(); ++i) {
+        BOOST_CHECK(not_inverted[i] == composite_elements[i]);
+        BOOST_CHECK(not_inverted_parallel[i] == composite_elements[i]);
+    }
+}
+
+/// multiplication keeps track of poisoned factors, the inversion of a poisoned product throws
+struct poisoned_element {
+    bool poisoned;
+
+    bool is_zero() const {
+        return false;
+    }
+
+    poisoned_element operator*(const poisoned_element& o) const {
+        return {poisoned || o.poisoned};
+    }
+
+    poisoned_element& operator*=(const poisoned_element& o) {
+        poisoned = poisoned || o.poisoned;
+        return *this;
+    }
+};
+
+poisoned_element inverse_mod(const poisoned_element& a) {
+    if (a.poisoned) {
+        throw std::domain_error("element is not invertible");
+    }
+    return a;
+}
+
 BOOST_AUTO_TEST_SUITE(runtime_tests)
 
 BOOST_AUTO_TEST_CASE(inverse_tests) {
@@ -311,6 +386,22 @@ BOOST_AUTO_TEST_CASE(inverse_tests) {
 #endif
 }
 
+BOOST_AUTO_TEST_CASE(batch_inverse_tests) {
+    test_batch_inverse_mod<nil::crypto3::multiprecision::cpp_int_backend<256, 256>>();
+    test_batch_inverse_mod<nil::crypto3::multiprecision::cpp_int_backend<>>();
+}
+
+BOOST_AUTO_TEST_CASE(parallel_batch_inverse_exception) {
+    /// the poisoned element is in the first chunk, which is inverted by a worker thread
+    std::vector<poisoned_element> elements(1000, poisoned_element {false});
+    elements[10].poisoned = true;
+    BOOST_CHECK_THROW(parallel_batch_inverse_mod(elements.begin(), elements.end(), 4), std::domain_error);
+
+    elements[10].poisoned = false;
+    elements[990].poisoned = true;
+    BOOST_CHECK_THROW(parallel_batch_inverse_mod(elements.begin(), elements.end(), 4), std::domain_error);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE(static_tests)
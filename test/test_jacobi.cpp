@@ -40,6 +40,8 @@ BOOST_MP_DEFINE_SIZED_CPP_INT_LITERAL(256);
 
 #include <nil/crypto3/multiprecision/jacobi.hpp>
 
+#include <boost/random.hpp>
+
 template<typename T>
 void test() {
     using namespace nil::crypto3::multiprecision;
@@ -68,18 +70,78 @@ void test() {
         -1);
 }
 
+//
+// Random operands on both sides of the binary / Lehmer switch of cpp_int, checked against the
+// multiplicativity in the numerator and the quadratic reciprocity
+//
+template<typename T>
+void test_properties() {
+    using namespace nil::crypto3::multiprecision;
+
+    boost::random::mt19937 gen;
+    for (unsigned bits : {40u, 64u, 100u, 128u, 200u, 256u, 512u, 1000u, 2048u}) {
+        boost::random::uniform_int_distribution<T> dist(T(3), (T(1) << bits) - 1);
+        for (unsigned i = 0; i < 50; ++i) {
+            T n = dist(gen) | 1u, m = dist(gen) | 1u, a = dist(gen), b = dist(gen);
+
+            int j = jacobi(T(a * b % n), n);
+            BOOST_CHECK_EQUAL(j, jacobi(T(a % n), n) * jacobi(T(b % n), n));
+            j = jacobi(T(a * a % n), n);
+            BOOST_CHECK(j == 0 || j == 1);
+            j = jacobi(T(n * (a % 8u) % n), n);
+            BOOST_CHECK_EQUAL(j, 0);
+
+            /// (m / n) * (n / m) = -1 exactly for m = n = 3 mod 4, zero for a common factor
+            const int reciprocity = (integer_modulus(m, 4) == 3 && integer_modulus(n, 4) == 3) ? -1 : 1;
+            j = jacobi(m, n) * jacobi(n, m);
+            BOOST_CHECK_EQUAL(j, gcd(m, n) == 1u ? reciprocity : 0);
+        }
+    }
+}
+
+#if defined(TEST_CPP_INT) && defined(TEST_GMP)
+//
+// Known answers of GMP's mpz_jacobi for multi-limb operands below and above jacobi_lehmer_limbs_threshold limbs,
+// the properties above would not catch a consistently wrong sign of the Lehmer path
+//
+template<typename T>
+void test_against_gmp() {
+    using namespace nil::crypto3::multiprecision;
+
+    boost::random::mt19937 gen;
+    for (unsigned bits : {65u, 128u, 129u, 191u, 192u, 193u, 256u, 257u, 1000u, 2048u}) {
+        boost::random::uniform_int_distribution<T> dist(T(1), (T(1) << bits) - 1);
+        for (unsigned i = 0; i < 100; ++i) {
+            const T n = dist(gen) | 1u;
+            /// both reduced and unreduced numerators, with small and full size ones
+            const T a = i % 4 == 0 ? T(dist(gen) >> (bits / 2)) : dist(gen);
+
+            const mpz_int za(a.str()), zn(n.str());
+            BOOST_CHECK_EQUAL(jacobi(a, n), mpz_jacobi(za.backend().data(), zn.backend().data()));
+        }
+    }
+}
+#endif
+
 int main() {
     using namespace nil::crypto3::multiprecision;
 
 #if defined(TEST_CPP_INT)
     test<cpp_int>();
+    test_properties<cpp_int>();
+    test_properties<number<cpp_int_backend<4096, 4096, unsigned_magnitude, checked, void>>>();
 
     constexpr auto a = 0x4931a5f_cppui256;
     constexpr auto b = 0x73eda753299d7d483339d80809a1d80553bda402fffe5bfeffffffff00000001_cppui256;
     static_assert(jacobi(a, b) == -1, "jacobi error");
 #endif
+#if defined(TEST_CPP_INT) && defined(TEST_GMP)
+    test_against_gmp<cpp_int>();
+    test_against_gmp<number<cpp_int_backend<4096, 4096, unsigned_magnitude, checked, void>>>();
+#endif
 #if defined(TEST_GMP)
     test<mpz_int>();
+    test_properties<mpz_int>();
 #endif
 #if defined(TEST_TOMMATH)
     test<tom_int>();
@@ -65,6 +65,44 @@ void test() {
     }
 }
 
+template<class I>
+void test_witnesses() {
+    //
+    // The deterministic witness set for 64-bit inputs should agree with GMP on every value and reject strong
+    // pseudoprimes to all the small prime bases.
+    //
+    using namespace boost::random;
+    using namespace nil::crypto3::multiprecision;
+
+    typedef I test_type;
+
+    const std::uint64_t* first = std::begin(miller_rabin_witnesses_64);
+    const std::uint64_t* last = std::end(miller_rabin_witnesses_64);
+
+    independent_bits_engine<mt11213b, 64, boost::uint64_t> gen;
+
+    for (unsigned i = 0; i < 10000; ++i) {
+        boost::uint64_t n = gen() | 1u;
+        bool is_prime_boost = miller_rabin_test(test_type(n), first, last);
+        bool is_gmp_prime = mpz_probab_prime_p(mpz_int(n).backend().data(), 25) ? true : false;
+        if (is_prime_boost != is_gmp_prime)
+            std::cout << std::hex << std::showbase << "n = " << n << std::endl;
+        BOOST_CHECK_EQUAL(is_prime_boost, is_gmp_prime);
+    }
+
+    BOOST_TEST(!miller_rabin_test(test_type(3215031751u), first, last));
+    BOOST_TEST(!miller_rabin_test(test_type(UINT64_C(3825123056546413051)), first, last));
+    BOOST_TEST(miller_rabin_test(test_type(UINT64_C(18446744073709551557)), first, last));
+
+    //
+    // The engine reuses the reduction state of n for any count of witnesses:
+    //
+    miller_rabin_engine<test_type> engine(test_type(UINT64_C(3825123056546413051)));
+    const unsigned small_primes[] = {2u, 3u, 5u, 7u, 11u, 13u, 17u, 19u, 23u, 29u, 31u};
+    BOOST_TEST(engine.test(std::begin(small_primes), std::end(small_primes)));
+    BOOST_TEST(!engine.is_strong_probable_prime(test_type(37u)));
+}
+
 int main() {
     using namespace nil::crypto3::multiprecision;
 
@@ -77,6 +115,12 @@ int main() {
     test<number<cpp_int_backend<64, 64, unsigned_magnitude, checked, void>, et_off>>();
     test<checked_uint128_t>();
     test<checked_uint1024_t>();
+    test<number<cpp_int_backend<256, 256, unsigned_magnitude, unchecked, void>>>();
+
+    test_witnesses<mpz_int>();
+    test_witnesses<boost::uint64_t>();
+    test_witnesses<cpp_int>();
+    test_witnesses<number<cpp_int_backend<256, 256, unsigned_magnitude, unchecked, void>>>();
 
     return boost::report_errors();
 }
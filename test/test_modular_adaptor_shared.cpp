@@ -0,0 +1,245 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE modular_shared_multiprecision_test
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/multiprecision/cpp_int.hpp>
+#include <nil/crypto3/multiprecision/cpp_int/literals.hpp>
+#include <nil/crypto3/multiprecision/cpp_modular.hpp>
+#include <nil/crypto3/multiprecision/modular/modular_adaptor.hpp>
+#include <nil/crypto3/multiprecision/modular/fixed_base_exponentiator.hpp>
+#include <nil/crypto3/multiprecision/inverse.hpp>
+
+BOOST_MP_DEFINE_SIZED_CPP_INT_LITERAL(256);
+
+using namespace nil::crypto3::multiprecision;
+
+typedef modular_fixed_cpp_int_backend<256, signed_magnitude, unchecked> backend_256_type;
+typedef number<backend_256_type> number_256_type;
+
+struct secp256r1_tag;
+struct even_modulus_tag;
+
+typedef shared_modular_params<backend_256_type, secp256r1_tag> secp256r1_params;
+typedef shared_modular_params<backend_256_type, even_modulus_tag> even_modulus_params;
+
+struct secp256r1_modulus {
+    static constexpr number_256_type value =
+        0xffffffff00000001000000000000000000000000ffffffffffffffffffffffff_cppi256;
+};
+constexpr number_256_type secp256r1_modulus::value;
+
+typedef constexpr_modular_params<backend_256_type, secp256r1_modulus> secp256r1_constexpr_params;
+typedef constexpr_modular_params<backend_256_type, literals::detail::value_pack<0x3e9u>> modulus_1001_constexpr_params;
+
+typedef number<modular_adaptor<backend_256_type>> modular_256_type;
+
+template<typename ModularParamsHolder>
+using shared_modular_256_type = number<modular_adaptor<backend_256_type, ModularParamsHolder>>;
+
+template<typename ModularParamsHolder>
+void check_against_by_value(const number_256_type& m, const number_256_type& x, const number_256_type& y) {
+    typedef shared_modular_256_type<ModularParamsHolder> shared_type;
+
+    ModularParamsHolder::set_mod(m);
+
+    shared_type a(x), b(y);
+    modular_256_type a_v(x, m), b_v(y, m);
+
+    BOOST_CHECK_EQUAL((a + b).str(), (a_v + b_v).str());
+    BOOST_CHECK_EQUAL((a - b).str(), (a_v - b_v).str());
+    BOOST_CHECK_EQUAL((b - a).str(), (b_v - a_v).str());
+    BOOST_CHECK_EQUAL((a * b).str(), (a_v * b_v).str());
+    BOOST_CHECK_EQUAL(powm(a, y).str(), powm(a_v, y).str());
+    BOOST_CHECK_EQUAL(powm_fixed_window(a, y).str(), powm(a_v, y).str());
+    BOOST_CHECK_EQUAL(powm_fixed_window(a_v, y).str(), powm(a_v, y).str());
+    BOOST_CHECK_EQUAL(pow(a, b).str(), pow(a_v, b_v).str());
+    BOOST_CHECK(-a + a == 0);
+    BOOST_CHECK(a == a);
+    BOOST_CHECK(a != b);
+}
+
+/// right-to-left square-and-multiply on cpp_int, independent of the window code of the modular backends
+cpp_int reference_powm(cpp_int b, cpp_int e, const cpp_int& m) {
+    cpp_int result = 1;
+    b %= m;
+    while (e != 0) {
+        if (bit_test(e, 0)) {
+            result = result * b % m;
+        }
+        b = b * b % m;
+        e >>= 1;
+    }
+    return result % m;
+}
+
+BOOST_AUTO_TEST_SUITE(modular_shared_tests)
+
+BOOST_AUTO_TEST_CASE(element_size) {
+    BOOST_CHECK_EQUAL(sizeof(shared_modular_256_type<secp256r1_params>), sizeof(backend_256_type));
+    BOOST_CHECK_LT(sizeof(shared_modular_256_type<secp256r1_params>), sizeof(modular_256_type));
+}
+
+BOOST_AUTO_TEST_CASE(arithmetic) {
+    number_256_type x("0x1234567890abcdef1234567890abcdef1234567890abcdef"),
+        y("0xfedcba0987654321fedcba0987654321fedcba09876543");
+
+    // montgomery form is used for odd modulus
+    check_against_by_value<secp256r1_params>(
+        number_256_type("0xffffffff00000001000000000000000000000000ffffffffffffffffffffffff"), x, y);
+    // barrett reduction is used for even modulus
+    check_against_by_value<even_modulus_params>(
+        number_256_type("0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2e"), x, y);
+}
+
+BOOST_AUTO_TEST_CASE(independent_moduli) {
+    secp256r1_params::set_mod(number_256_type("0xffffffff00000001000000000000000000000000ffffffffffffffffffffffff"));
+    even_modulus_params::set_mod(number_256_type(1000));
+
+    shared_modular_256_type<secp256r1_params> a(1234), b(4321);
+    shared_modular_256_type<even_modulus_params> c(1234), d(4321);
+
+    BOOST_CHECK_EQUAL((a * b).str(), "5332114");
+    BOOST_CHECK_EQUAL((c * d).str(), "114");
+    BOOST_CHECK_EQUAL((c - d).str(), "913");
+}
+
+BOOST_AUTO_TEST_CASE(inverse) {
+    secp256r1_params::set_mod(number_256_type("0xffffffff00000001000000000000000000000000ffffffffffffffffffffffff"));
+
+    shared_modular_256_type<secp256r1_params> a(number_256_type("0x1234567890abcdef1234567890abcdef"));
+    BOOST_CHECK(inverse_mod(a) * a == 1);
+}
+
+BOOST_AUTO_TEST_CASE(safegcd_inverse) {
+    number_256_type odd_m("0xffffffff00000001000000000000000000000000ffffffffffffffffffffffff"),
+        short_m("0x3ffffffffffffffffffb");
+    number_256_type composite_m = short_m * 3;
+
+    for (const number_256_type& m : {odd_m, short_m, composite_m}) {
+        secp256r1_params::set_mod(m);
+
+        for (const number_256_type& x :
+             {number_256_type(1), number_256_type(2), number_256_type(3), number_256_type(m - 1),
+              number_256_type("0x1234567890abcdef1234567890abcdef1234567890abcdef1234567890abcdef") % m}) {
+            cpp_int expected = inverse_mod(cpp_int(x), cpp_int(m));
+            if (expected == 0) {
+                /// not invertible modulo composite modulus
+                BOOST_CHECK(inverse_mod(shared_modular_256_type<secp256r1_params>(x)) == 0);
+                continue;
+            }
+
+            shared_modular_256_type<secp256r1_params> a(x);
+            modular_256_type a_v(x, m);
+            BOOST_CHECK_EQUAL(inverse_mod(a).str(), expected.str());
+            BOOST_CHECK_EQUAL(inverse_mod(a_v).str(), expected.str());
+            BOOST_CHECK(inverse_mod(a) * a == 1);
+        }
+
+        BOOST_CHECK(inverse_mod(shared_modular_256_type<secp256r1_params>(0)) == 0);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(squaring) {
+    number_256_type x("0x1234567890abcdef1234567890abcdef1234567890abcdef1234567890abcdef");
+    number_256_type odd_m("0xffffffff00000001000000000000000000000000ffffffffffffffffffffffff"),
+        even_m("0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2e"), short_m("0x3ffffffffffffffffffb");
+
+    for (const number_256_type& m : {odd_m, even_m, short_m}) {
+        secp256r1_params::set_mod(m);
+
+        shared_modular_256_type<secp256r1_params> a(x), b(x);
+        shared_modular_256_type<secp256r1_params> c = a;
+        c *= c;
+        BOOST_CHECK_EQUAL((a * a).str(), (a * b).str());
+        BOOST_CHECK_EQUAL(c.str(), (a * b).str());
+
+        modular_256_type a_v(x, m), b_v(x, m);
+        modular_256_type c_v = a_v;
+        c_v *= c_v;
+        BOOST_CHECK_EQUAL((a_v * a_v).str(), (a_v * b_v).str());
+        BOOST_CHECK_EQUAL(c_v.str(), (a_v * b_v).str());
+        BOOST_CHECK_EQUAL((a_v * a_v).str(), (a * b).str());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(fixed_base_exponentiation) {
+    number_256_type g("0x6b17d1f2e12c4247f8bce6e563a440f277037d812deb33a0f4a13945d898c296");
+    number_256_type odd_m("0xffffffff00000001000000000000000000000000ffffffffffffffffffffffff"),
+        even_m("0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2e");
+
+    for (const number_256_type& m : {odd_m, even_m}) {
+        secp256r1_params::set_mod(m);
+
+        fixed_base_exponentiator<backend_256_type> by_value(g, modular_params<backend_256_type>(m));
+        shared_modular_256_type<secp256r1_params> shared_g(g);
+        fixed_base_exponentiator<backend_256_type, secp256r1_params> shared(shared_g);
+        /// 5-bit windows do not divide 64, exponents above 64 bits are passed to powm
+        fixed_base_exponentiator<backend_256_type> short_exp(modular_256_type(g, m), 64, 5);
+
+        for (const number_256_type& e :
+             {number_256_type(0), number_256_type(1), number_256_type(0xffffffffffffffffULL), number_256_type(m - 1),
+              number_256_type("0x1234567890abcdef1234567890abcdef1234567890abcdef1234567890abcdef")}) {
+            modular_256_type expected = powm(modular_256_type(g, m), e);
+
+            BOOST_CHECK_EQUAL(by_value.pow(e).str(), expected.str());
+            BOOST_CHECK_EQUAL(shared.pow(e).str(), expected.str());
+            BOOST_CHECK_EQUAL(short_exp.pow(e).str(), expected.str());
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(exponentiation_reference) {
+    typedef modular_fixed_cpp_int_backend<1024, signed_magnitude, unchecked> backend_1024_type;
+    typedef number<backend_1024_type> number_1024_type;
+    typedef number<modular_adaptor<backend_1024_type>> modular_1024_type;
+
+    const cpp_int g("0x6b17d1f2e12c4247f8bce6e563a440f277037d812deb33a0f4a13945d898c2961234567890abcdef"),
+        e_all("0xbfd4235992edcf451a1afe878b33e968617959ce3f1f65a8de5271007814e8a2"
+              "5f2dd97f1cfb10f62827688de6a16a3b0d464138a62332553fc1ea36f17fd374"
+              "c6a5387777330bdbd7210dff076ce2ef87b0b125ec1d7da0a6eb8c9ebd69fe29"
+              "d76d4330f1446beab0c11fdecb91ce375bc8fbbcbde5c0994164d8399f767c45");
+    /// odd modulus goes through Montgomery form, even modulus through Barrett reduction
+    const cpp_int odd_m = (cpp_int(1) << 1023) + 1155, even_m = (cpp_int(1) << 1022) + 2022;
+
+    for (const cpp_int& m : {odd_m, even_m}) {
+        const modular_1024_type base{number_1024_type(g), number_1024_type(m)};
+        /// exponent lengths on both sides of each window size threshold
+        for (unsigned bits : {1u, 2u, 23u, 24u, 79u, 80u, 239u, 240u, 671u, 672u, 1024u}) {
+            const cpp_int e = e_all >> (msb(e_all) + 1 - bits);
+            const std::string expected = reference_powm(g, e, m).str();
+
+            BOOST_CHECK_EQUAL(powm(base, number_1024_type(e)).str(), expected);
+            BOOST_CHECK_EQUAL(powm_fixed_window(base, number_1024_type(e)).str(), expected);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(constexpr_params) {
+    static_assert(secp256r1_constexpr_params::mod_data().get_mod() == secp256r1_modulus::value,
+                  "modulus should be available at compile time");
+
+    number_256_type x("0x1234567890abcdef1234567890abcdef1234567890abcdef"),
+        y("0xfedcba0987654321fedcba0987654321fedcba09876543");
+    number_256_type m = secp256r1_modulus::value;
+
+    shared_modular_256_type<secp256r1_constexpr_params> a(x), b(y);
+    modular_256_type a_v(x, m), b_v(y, m);
+
+    BOOST_CHECK_EQUAL((a + b).str(), (a_v + b_v).str());
+    BOOST_CHECK_EQUAL((a - b).str(), (a_v - b_v).str());
+    BOOST_CHECK_EQUAL((a * b).str(), (a_v * b_v).str());
+    BOOST_CHECK_EQUAL(powm(a, y).str(), powm(a_v, y).str());
+
+    shared_modular_256_type<modulus_1001_constexpr_params> c(1234), d(4321);
+    BOOST_CHECK_EQUAL((c * d).str(), "788");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,138 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE multi_exp_multiprecision_test
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/multiprecision/cpp_int.hpp>
+#include <nil/crypto3/multiprecision/cpp_modular.hpp>
+#include <nil/crypto3/multiprecision/modular/modular_adaptor.hpp>
+#include <nil/crypto3/multiprecision/multi_exp.hpp>
+
+#include <boost/iterator/transform_iterator.hpp>
+#include <boost/random.hpp>
+
+#include <vector>
+
+using namespace nil::crypto3::multiprecision;
+
+typedef modular_fixed_cpp_int_backend<256, signed_magnitude, unchecked> backend_256_type;
+typedef number<backend_256_type> number_256_type;
+typedef number<modular_adaptor<backend_256_type>> modular_256_type;
+
+struct multi_exp_tag;
+typedef shared_modular_params<backend_256_type, multi_exp_tag> multi_exp_params;
+typedef number<modular_adaptor<backend_256_type, multi_exp_params>> shared_modular_256_type;
+
+typedef number<modular_adaptor<cpp_int_backend<>>> modular_cpp_int_type;
+
+//
+// Products of n random powers with a zero base and a zero exponent among them, make builds the residue of a number
+// modulo m
+//
+template<typename ModularType, typename Make>
+void check_products(const number_256_type& m, const Make& make) {
+    for (std::size_t n : {1, 2, 3, 7, 16, 40}) {
+        boost::random::mt19937 gen(static_cast<unsigned>(n));
+        boost::random::independent_bits_engine<boost::random::mt19937, 256, number_256_type> bits_gen(gen);
+
+        std::vector<ModularType> bases;
+        std::vector<number_256_type> exps;
+        std::vector<backend_256_type> exp_backends;
+        ModularType expected = make(1);
+        for (std::size_t i = 0; i < n; ++i) {
+            number_256_type base = i == 2 ? number_256_type(0) : number_256_type(bits_gen() % m);
+            number_256_type exp = i == 1 ? number_256_type(0) : bits_gen();
+
+            bases.push_back(make(base));
+            exps.push_back(exp);
+            exp_backends.push_back(exp.backend());
+            expected *= powm(bases.back(), exp);
+        }
+
+        BOOST_CHECK_EQUAL(multi_exp(bases.begin(), bases.end(), exps.begin()).str(), expected.str());
+        BOOST_CHECK_EQUAL(multi_exp_straus(bases.begin(), bases.end(), exp_backends.begin()).str(), expected.str());
+        BOOST_CHECK_EQUAL(multi_exp_straus(bases.begin(), bases.end(), exps.begin(), 2).str(), expected.str());
+        BOOST_CHECK_EQUAL(multi_exp_pippenger(bases.begin(), bases.end(), exps.begin()).str(), expected.str());
+        BOOST_CHECK_EQUAL(multi_exp_pippenger(bases.begin(), bases.end(), exp_backends.begin(), 5).str(),
+                          expected.str());
+
+        /// exponents yielded by value do not outlive the dereference of the iterator
+        const auto by_value = [](const number_256_type& e) { return number_256_type(e); };
+        BOOST_CHECK_EQUAL(
+            multi_exp_straus(bases.begin(), bases.end(), boost::make_transform_iterator(exps.begin(), by_value)).str(),
+            expected.str());
+        BOOST_CHECK_EQUAL(multi_exp_pippenger(bases.begin(), bases.end(),
+                                              boost::make_transform_iterator(exps.begin(), by_value))
+                              .str(),
+                          expected.str());
+    }
+}
+
+void check_multi_exp(const number_256_type& m) {
+    check_products<modular_256_type>(m, [&m](const number_256_type& x) { return modular_256_type(x, m); });
+}
+
+void check_shared_multi_exp(const number_256_type& m) {
+    multi_exp_params::set_mod(m);
+    check_products<shared_modular_256_type>(m, [](const number_256_type& x) { return shared_modular_256_type(x); });
+}
+
+BOOST_AUTO_TEST_SUITE(multi_exp_tests)
+
+BOOST_AUTO_TEST_CASE(fixed_modular) {
+    // montgomery form is used for odd modulus
+    check_multi_exp(number_256_type("0xffffffff00000001000000000000000000000000ffffffffffffffffffffffff"));
+    check_shared_multi_exp(number_256_type("0xffffffff00000001000000000000000000000000ffffffffffffffffffffffff"));
+    // barrett reduction is used for even modulus
+    check_multi_exp(number_256_type("0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2e"));
+}
+
+BOOST_AUTO_TEST_CASE(non_invertible_base) {
+    // 2^255 - 19 times 3, the base 3 * 7 has no inverse while the other ones have
+    const number_256_type p("0x7fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffed"), m = p * 3;
+    std::vector<modular_256_type> bases;
+    std::vector<number_256_type> exps;
+    modular_256_type expected(1, m);
+    for (unsigned i = 0; i < 6; ++i) {
+        bases.emplace_back(i == 3 ? number_256_type(21) : number_256_type(i + 2), m);
+        /// exponents with negative wNAF digits
+        exps.push_back((number_256_type(0xbbbbbbbbbbbbbbbbu) << (32 * i)) + 0x7777u);
+        expected *= powm(bases.back(), exps.back());
+    }
+
+    BOOST_CHECK_EQUAL(multi_exp_straus(bases.begin(), bases.end(), exps.begin()).str(), expected.str());
+    BOOST_CHECK_EQUAL(multi_exp_pippenger(bases.begin(), bases.end(), exps.begin()).str(), expected.str());
+}
+
+BOOST_AUTO_TEST_CASE(zero_exponents) {
+    number_256_type m("0xffffffff00000001000000000000000000000000ffffffffffffffffffffffff");
+    std::vector<modular_256_type> bases = {modular_256_type(3, m), modular_256_type(5, m)};
+    std::vector<number_256_type> exps = {0, 0};
+
+    BOOST_CHECK(multi_exp_straus(bases.begin(), bases.end(), exps.begin()) == modular_256_type(1, m));
+    BOOST_CHECK(multi_exp_pippenger(bases.begin(), bases.end(), exps.begin()) == modular_256_type(1, m));
+}
+
+BOOST_AUTO_TEST_CASE(dynamic_modular) {
+    cpp_int m("0xffffffff00000001000000000000000000000000ffffffffffffffffffffffff");
+    std::vector<modular_cpp_int_type> bases = {modular_cpp_int_type(3, m), modular_cpp_int_type(5, m),
+                                               modular_cpp_int_type(cpp_int("0x1234567890abcdef"), m)};
+    std::vector<cpp_int> exps = {cpp_int("0xfedcba0987654321fedcba0987654321"), 65537, cpp_int(m - 2)};
+
+    modular_cpp_int_type expected(1, m);
+    for (std::size_t i = 0; i < bases.size(); ++i) {
+        expected *= powm(bases[i], exps[i]);
+    }
+
+    BOOST_CHECK(multi_exp_straus(bases.begin(), bases.end(), exps.begin()) == expected);
+    BOOST_CHECK(multi_exp_pippenger(bases.begin(), bases.end(), exps.begin()) == expected);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
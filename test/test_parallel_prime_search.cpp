@@ -0,0 +1,93 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2020 Mikhail Komarov. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+#include <nil/crypto3/multiprecision/gmp.hpp>
+#include <nil/crypto3/multiprecision/cpp_int.hpp>
+#include <nil/crypto3/multiprecision/parallel_prime_search.hpp>
+#include <iostream>
+#include <iomanip>
+#include "test.hpp"
+
+template<class I>
+void test() {
+    //
+    // Whatever the count of threads is, the parallel search should find the first prime above the start, the one
+    // GMP's mpz_nextprime finds, and repeated searches with the same seed should agree.
+    //
+    using namespace boost::random;
+    using namespace nil::crypto3::multiprecision;
+
+    typedef I test_type;
+
+    mt11213b base_gen;
+    independent_bits_engine<mt11213b, 256, test_type> gen(base_gen);
+
+    for (unsigned i = 0; i < 5; ++i) {
+        test_type start = gen();
+
+        mpz_int expected(start - 1);
+        mpz_nextprime(expected.backend().data(), expected.backend().data());
+
+        for (std::size_t threads_count : {1, 2, 3, 8}) {
+            // small blocks make every worker take part
+            test_type p = parallel_find_prime(start, i, false, 25, threads_count, 16);
+            BOOST_CHECK_EQUAL(mpz_int(p), expected);
+        }
+    }
+
+    for (unsigned i = 0; i < 2; ++i) {
+        test_type start = gen() >> 128u;
+        test_type expected = prime_generator<test_type>(start, true).next();
+
+        for (std::size_t threads_count : {1, 4}) {
+            test_type p = parallel_find_prime(start, i, true, 25, threads_count, 64);
+            BOOST_CHECK_EQUAL(p, expected);
+            BOOST_TEST(mpz_probab_prime_p(mpz_int(p).backend().data(), 25));
+            BOOST_TEST(mpz_probab_prime_p(mpz_int(p >> 1u).backend().data(), 25));
+        }
+    }
+
+    test_type p = parallel_random_prime<192, test_type>(42u, false, 25, 4);
+    BOOST_CHECK_EQUAL(msb(p), 191u);
+    BOOST_TEST(mpz_probab_prime_p(mpz_int(p).backend().data(), 25));
+    test_type repeated = parallel_random_prime<192, test_type>(42u, false, 25, 4);
+    BOOST_CHECK_EQUAL(repeated, p);
+
+    // the stride loop skips 2 and the safe prime 5
+    for (unsigned start = 0; start < 8; ++start) {
+        BOOST_CHECK_EQUAL(parallel_find_prime(test_type(start), 0u, false, 25, 2),
+                          test_type(start <= 2 ? 2 : start <= 3 ? 3 : start <= 5 ? 5 : 7));
+        BOOST_CHECK_EQUAL(parallel_find_prime(test_type(start), 0u, true, 25, 2), test_type(start <= 5 ? 5 : 7));
+    }
+}
+
+void test_worker_exception() {
+    //
+    // There is no 64-bit prime above 2^64 - 59, so every worker overflows a checked 64-bit number at the end of
+    // its block, the exception should reach the caller instead of terminating the process.
+    //
+    using namespace nil::crypto3::multiprecision;
+
+    typedef number<cpp_int_backend<64, 64, unsigned_magnitude, checked, void>> test_type;
+
+    const test_type start = (std::numeric_limits<test_type>::max)() - 50u;
+    for (std::size_t threads_count : {1, 2, 4}) {
+        BOOST_CHECK_THROW(parallel_find_prime(start, 0u, false, 25, threads_count, 16), std::overflow_error);
+    }
+}
+
+int main() {
+    using namespace nil::crypto3::multiprecision;
+
+    test<cpp_int>();
+    test<number<cpp_int_backend<256, 256, unsigned_magnitude, unchecked, void>>>();
+    test_worker_exception();
+
+    return boost::report_errors();
+}
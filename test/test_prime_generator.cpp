@@ -0,0 +1,111 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2020 Mikhail Komarov. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+#include <nil/crypto3/multiprecision/gmp.hpp>
+#include <nil/crypto3/multiprecision/cpp_int.hpp>
+#include <nil/crypto3/multiprecision/prime_generator.hpp>
+#include <iostream>
+#include <iomanip>
+#include "test.hpp"
+
+template<class I>
+void test(unsigned bits) {
+    //
+    // The generator should find exactly the primes GMP's mpz_nextprime finds, and the safe primes GMP
+    // confirms with nothing skipped in between.
+    //
+    using namespace boost::random;
+    using namespace nil::crypto3::multiprecision;
+
+    typedef I test_type;
+
+    mt11213b base_gen;
+    independent_bits_engine<mt11213b, 256, test_type> gen(base_gen);
+
+    for (unsigned i = 0; i < 5; ++i) {
+        test_type start = gen() >> (256 - bits);
+        prime_generator<test_type> generator(start);
+
+        mpz_int expected(start), previous;
+        --expected;
+        for (unsigned j = 0; j < 20; ++j) {
+            mpz_nextprime(expected.backend().data(), expected.backend().data());
+            test_type p = generator.next();
+            BOOST_CHECK_EQUAL(mpz_int(p), expected);
+        }
+    }
+
+    test_type start = gen() >> (256 - bits / 2);
+    prime_generator<test_type> generator(start, true);
+    BOOST_TEST(generator.is_safe_prime_mode());
+
+    test_type previous = start;
+    for (unsigned j = 0; j < 3; ++j) {
+        test_type p = generator.next();
+        BOOST_TEST(mpz_probab_prime_p(mpz_int(p).backend().data(), 25));
+        BOOST_TEST(mpz_probab_prime_p(mpz_int((p - 1) / 2).backend().data(), 25));
+
+        for (test_type c = previous; c < p; ++c) {
+            if (mpz_probab_prime_p(mpz_int(c).backend().data(), 25) &&
+                mpz_probab_prime_p(mpz_int(c >> 1u).backend().data(), 25) && integer_modulus(c, 4u) == 3u) {
+                std::cout << std::hex << std::showbase << "skipped safe prime " << c << std::endl;
+                BOOST_ERROR("safe prime skipped");
+            }
+        }
+        previous = p + 1;
+    }
+
+    //
+    // Small starts: sieve primes are candidates themselves
+    //
+    prime_generator<test_type> small_generator(test_type(0u));
+    const unsigned small_primes[] = {2u, 3u, 5u, 7u, 11u, 13u, 17u, 19u, 23u};
+    for (unsigned p : small_primes) {
+        BOOST_CHECK_EQUAL(small_generator.next(), test_type(p));
+    }
+    prime_generator<test_type> small_safe_generator(test_type(0u), true);
+    const unsigned small_safe_primes[] = {5u, 7u, 11u, 23u, 47u, 59u, 83u, 107u};
+    for (unsigned p : small_safe_primes) {
+        BOOST_CHECK_EQUAL(small_safe_generator.next(), test_type(p));
+    }
+}
+
+template<class I>
+void test_small_starts() {
+    //
+    // 2 and 5 are not on the walk, they come first for the starts not above them
+    //
+    using namespace nil::crypto3::multiprecision;
+
+    typedef I test_type;
+
+    const unsigned primes[] = {2u, 2u, 2u, 3u, 5u, 5u, 7u};
+    const unsigned safe_primes[] = {5u, 5u, 5u, 5u, 5u, 5u, 7u};
+    for (unsigned start = 0; start <= 6; ++start) {
+        const test_type start_value(start);
+        prime_generator<test_type> generator(start_value);
+        BOOST_CHECK_EQUAL(generator.next(), test_type(primes[start]));
+        prime_generator<test_type> safe_generator(start_value, true);
+        BOOST_CHECK_EQUAL(safe_generator.next(), test_type(safe_primes[start]));
+    }
+}
+
+int main() {
+    using namespace nil::crypto3::multiprecision;
+
+    test<cpp_int>(256);
+    test<mpz_int>(256);
+    test<number<cpp_int_backend<256, 256, unsigned_magnitude, unchecked, void>>>(192);
+    test<checked_uint1024_t>(256);
+
+    test_small_starts<cpp_int>();
+    test_small_starts<mpz_int>();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,134 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE sqrt_context_multiprecision_test
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/multiprecision/cpp_int.hpp>
+#include <nil/crypto3/multiprecision/cpp_modular.hpp>
+#include <nil/crypto3/multiprecision/modular/modular_adaptor.hpp>
+#include <nil/crypto3/multiprecision/modular/sqrt_context.hpp>
+
+#include <boost/random.hpp>
+
+using namespace nil::crypto3::multiprecision;
+
+typedef modular_fixed_cpp_int_backend<256, signed_magnitude, unchecked> backend_256_type;
+typedef number<backend_256_type> number_256_type;
+typedef number<modular_adaptor<backend_256_type>> modular_256_type;
+
+struct sqrt_context_tag;
+typedef shared_modular_params<backend_256_type, sqrt_context_tag> sqrt_context_params;
+typedef number<modular_adaptor<backend_256_type, sqrt_context_params>> shared_modular_256_type;
+
+//
+// Every root found squares back to the input, the non-residues are exactly the inputs with the Jacobi symbol -1,
+// make builds the residue of a number modulo p
+//
+template<typename Context, typename Make>
+void check_roots(const number_256_type& p, int expected_algorithm, const Make& make) {
+    typedef typename Context::modular_type modular_type;
+
+    const Context context(make(0));
+    BOOST_CHECK_EQUAL(static_cast<int>(context.algorithm()), expected_algorithm);
+
+    boost::random::mt19937 gen(static_cast<unsigned>(integer_modulus(p, 1000u)));
+    boost::random::independent_bits_engine<boost::random::mt19937, 256, number_256_type> bits_gen(gen);
+
+    std::size_t squares_count = 0;
+    for (std::size_t i = 0; i < 200; ++i) {
+        /// 0, 1, -1 and 4 are among the inputs
+        number_256_type x = i == 0 ? number_256_type(0) :
+                            i == 1 ? number_256_type(1) :
+                            i == 2 ? number_256_type(p - 1) :
+                            i == 3 ? number_256_type(4) :
+                                     number_256_type(bits_gen() % p);
+        modular_type a = make(x), root;
+
+        const bool is_square = context.sqrt(a, root);
+        BOOST_CHECK_EQUAL(is_square, x.is_zero() || jacobi(x, p) == 1);
+        BOOST_CHECK_EQUAL(is_square, context.is_square(a));
+        if (is_square) {
+            BOOST_CHECK_EQUAL((root * root).str(), a.str());
+            ++squares_count;
+        }
+    }
+    /// about a half of the random inputs are squares
+    BOOST_CHECK(squares_count > 60 && squares_count < 140);
+}
+
+void check_sqrt(const number_256_type& p, int expected_algorithm) {
+    check_roots<sqrt_context<backend_256_type>>(
+        p, expected_algorithm, [&p](const number_256_type& x) { return modular_256_type(x, p); });
+}
+
+void check_shared_sqrt(const number_256_type& p, int expected_algorithm) {
+    sqrt_context_params::set_mod(p);
+    check_roots<sqrt_context<backend_256_type, sqrt_context_params>>(
+        p, expected_algorithm, [](const number_256_type& x) { return shared_modular_256_type(x); });
+}
+
+BOOST_AUTO_TEST_SUITE(sqrt_context_tests)
+
+BOOST_AUTO_TEST_CASE(three_mod_four) {
+    typedef sqrt_context<backend_256_type> context_type;
+    // alt_bn128 base field
+    check_sqrt(number_256_type("0x30644e72e131a029b85045b68181585d97816a916871ca8d3c208c16d87cfd47"),
+               context_type::three_mod_four);
+    // secp256k1 base field, the roots of x^3 + 7 in point decompression
+    check_shared_sqrt(number_256_type("0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f"),
+                      context_type::three_mod_four);
+}
+
+BOOST_AUTO_TEST_CASE(five_mod_eight) {
+    typedef sqrt_context<backend_256_type> context_type;
+    // curve25519 base field
+    check_sqrt(number_256_type("0x7fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffed"),
+               context_type::atkin);
+}
+
+BOOST_AUTO_TEST_CASE(tonelli_shanks) {
+    typedef sqrt_context<backend_256_type> context_type;
+    // alt_bn128 scalar field, s = 28
+    check_sqrt(number_256_type("0x30644e72e131a029b85045b68181585d2833e84879b9709143e1f593f0000001"),
+               context_type::tonelli_shanks);
+    // bls12-381 scalar field, s = 32
+    check_shared_sqrt(number_256_type("0x73eda753299d7d483339d80809a1d80553bda402fffe5bfeffffffff00000001"),
+                      context_type::tonelli_shanks);
+    // secp224r1 base field, s = 96
+    check_sqrt(number_256_type("0xffffffffffffffffffffffffffffffff000000000000000000000001"),
+               context_type::tonelli_shanks);
+}
+
+BOOST_AUTO_TEST_CASE(cipolla) {
+    typedef sqrt_context<backend_256_type> context_type;
+    // stark curve field, s = 192
+    check_sqrt(number_256_type("0x800000000000011000000000000000000000000000000000000000000000001"),
+               context_type::cipolla);
+}
+
+BOOST_AUTO_TEST_CASE(small_primes) {
+    typedef sqrt_context<backend_256_type> context_type;
+    for (unsigned p : {3u, 5u, 7u, 13u, 17u, 41u, 97u, 257u}) {
+        const context_type context(modular_256_type(0, number_256_type(p)));
+        for (unsigned x = 0; x < p; ++x) {
+            modular_256_type a(x, number_256_type(p)), root;
+            bool is_square = false;
+            for (unsigned y = 0; y < p && !is_square; ++y) {
+                is_square = (y * y) % p == x;
+            }
+            BOOST_CHECK_EQUAL(context.sqrt(a, root), is_square);
+            if (is_square) {
+                BOOST_CHECK(root * root == a);
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
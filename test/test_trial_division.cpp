@@ -0,0 +1,78 @@
+//---------------------------------------------------------------------------//
+// Copyright (c) 2020 Mikhail Komarov <nemo@nil.foundation>
+//
+// Distributed under the Boost Software License, Version 1.0
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+//---------------------------------------------------------------------------//
+
+#define BOOST_TEST_MODULE trial_division_multiprecision_test
+
+#include <boost/test/unit_test.hpp>
+
+#include <nil/crypto3/multiprecision/cpp_int.hpp>
+#include <nil/crypto3/multiprecision/trial_division.hpp>
+
+#include <boost/random.hpp>
+
+#include <vector>
+
+using namespace nil::crypto3::multiprecision;
+
+typedef number<cpp_int_backend<512, 512, unsigned_magnitude, unchecked, void>> uint512_type;
+
+template<typename Number>
+void check_residues(const trial_division_table& table, const Number& n) {
+    const std::vector<std::uint32_t>& primes = table.primes();
+    std::vector<std::uint32_t> residues(primes.size());
+    table.residues(n, residues.data());
+
+    std::uint32_t expected_factor = 0;
+    for (std::size_t i = 0; i < primes.size(); ++i) {
+        std::uint32_t expected = static_cast<std::uint32_t>(integer_modulus(n, primes[i]));
+        BOOST_CHECK_EQUAL(residues[i], expected);
+        if (!expected_factor && !expected) {
+            expected_factor = primes[i];
+        }
+    }
+    BOOST_CHECK_EQUAL(table.find_factor(n), expected_factor);
+}
+
+BOOST_AUTO_TEST_SUITE(trial_division_tests)
+
+BOOST_AUTO_TEST_CASE(first_primes) {
+    trial_division_table table(10000);
+    BOOST_CHECK_EQUAL(table.primes().size(), 10000u);
+    BOOST_CHECK_EQUAL(table.primes().front(), 3u);
+    BOOST_CHECK_EQUAL(table.primes().back(), 104743u);
+    BOOST_CHECK_LT(table.products_count(), table.primes().size() / 3);
+
+    trial_division_table small_table(48);
+    BOOST_CHECK_EQUAL(small_table.primes().back(), 227u);
+}
+
+BOOST_AUTO_TEST_CASE(residues) {
+    boost::random::mt19937 gen;
+    boost::random::independent_bits_engine<boost::random::mt19937, 1024, cpp_int> bits_gen(gen);
+
+    trial_division_table table(2000);
+    for (unsigned i = 0; i < 50; ++i) {
+        cpp_int n = bits_gen() >> (i * 20);
+        check_residues(table, n);
+        check_residues(table, cpp_int(-n));
+        check_residues(table, uint512_type(n));
+        check_residues(table, number<cpp_int_backend<64, 64, unsigned_magnitude, unchecked, void>>(n));
+    }
+
+    check_residues(table, cpp_int(0));
+    check_residues(table, cpp_int(104729u));
+    check_residues(table, (cpp_int(1) << 4096) - 1);
+
+    // products of large primes take one prime each
+    trial_division_table large_table(std::vector<std::uint32_t>{4294967291u, 4294967279u, 3u});
+    BOOST_CHECK_EQUAL(large_table.products_count(), 2u);
+    check_residues(large_table, cpp_int(4294967291u) * 4294967279u * 5u);
+    check_residues(large_table, bits_gen());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -35,10 +35,64 @@
 
 #include <nil/crypto3/multiprecision/wnaf.hpp>
 
+#include <cstdlib>
+
+#if defined(TEST_CPP_INT)
+template<typename Number>
+void test_wnaf_recoding(const Number& scalar) {
+    using namespace nil::crypto3::multiprecision;
+
+    constexpr std::size_t bits = std::numeric_limits<Number>::digits;
+
+    for (std::size_t window_size = 1; window_size < 8; ++window_size) {
+        std::array<std::int8_t, wnaf_length(bits)> wnaf;
+        std::size_t length = find_wnaf(wnaf, window_size, scalar);
+        std::vector<long> wnaf_vector = find_wnaf(window_size, scalar);
+
+        cpp_int value = 0;
+        for (std::size_t i = wnaf.size(); i-- > 0;) {
+            value = value * 2 + int(wnaf[i]);
+            BOOST_CHECK_EQUAL(long(wnaf[i]), i < wnaf_vector.size() ? wnaf_vector[i] : 0);
+            if (wnaf[i]) {
+                BOOST_CHECK(wnaf[i] % 2 != 0);
+                BOOST_CHECK_LT(std::abs(int(wnaf[i])), 1 << window_size);
+                BOOST_CHECK_LT(i, length);
+                for (std::size_t j = i + 1; j <= i + window_size && j < wnaf.size(); ++j) {
+                    BOOST_CHECK_EQUAL(int(wnaf[j]), 0);
+                }
+            }
+        }
+        BOOST_CHECK_EQUAL(value, cpp_int(scalar));
+        BOOST_CHECK(length == 0 || wnaf[length - 1] != 0);
+    }
+
+    std::array<std::int8_t, fixed_window_length(bits, 5)> fixed_window;
+    find_fixed_window(fixed_window, 5, scalar);
+    cpp_int value = 0;
+    for (std::size_t i = fixed_window.size(); i-- > 0;) {
+        value = value * 32 + int(fixed_window[i]);
+        BOOST_CHECK_GE(int(fixed_window[i]), -16);
+        BOOST_CHECK_LT(int(fixed_window[i]), 16);
+    }
+    BOOST_CHECK_EQUAL(value, cpp_int(scalar));
+}
+#endif
+
 int main() {
     using namespace nil::crypto3::multiprecision;
 
 #if defined(TEST_CPP_INT)
+    typedef number<cpp_int_backend<256, 256, unsigned_magnitude, unchecked, void>> uint256_type;
+
+    for (const uint256_type& scalar :
+         {uint256_type(0), uint256_type(1), uint256_type(0xffffffffffffffffULL),
+          uint256_type("0x7fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff"),
+          uint256_type("0xffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff"),
+          uint256_type("0xfedcba0987654321fedcba0987654321fedcba0987654321fedcba0987654321"),
+          uint256_type("0x1000000000000000000000000000000000000000000000000000000000000001")}) {
+        test_wnaf_recoding(scalar);
+    }
+    test_wnaf_recoding(uint128_t("0xaaaaaaaaaaaaaaaa5555555555555555"));
 #endif
 #if defined(TEST_GMP)
 #endif